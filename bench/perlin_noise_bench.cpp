@@ -0,0 +1,110 @@
+/**
+ * @file perlin_noise_bench.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief Micro-benchmark of PerlinNoise's 2D heightmap path against the 3D path sampled at z = 0.
+ * Not part of the game. Build and run it with `make bench PROFILE=RELEASE && ./perlin_noise_bench`.
+ */
+
+#include "perlin_noise.hpp"
+
+// Keeps the compiler from discarding the samples being timed
+static volatile float sink;
+
+/**
+ * @brief Measures the average time taken by __sample__ across __count__ calls.
+ * @since 16-10-2026
+ * @param[in] count The amount of samples to take
+ * @param[in] sample Takes the sample with the given index
+ * @returns The average time per sample (in nanoseconds)
+ */
+static double time_samples(const size_t count, const std::function<float(size_t)> &sample)
+{
+    float sum = 0.0f;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; ++i)
+    {
+        sum += sample(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    sink = sum;
+    return std::chrono::duration<double, std::nano>(end - start).count() / count;
+}
+
+/**
+ * @brief Prints the per-sample times of a 3D and 2D variant, along with the 2D variant's saving.
+ * @since 16-10-2026
+ * @param[in] name The name of the function being measured
+ * @param[in] ns_3d The time per sample of the 3D variant (in nanoseconds)
+ * @param[in] ns_2d The time per sample of the 2D variant (in nanoseconds)
+ */
+static void print_result(const char *name, const double ns_3d, const double ns_2d)
+{
+    std::cout << name << ": 3D " << ns_3d << " ns, 2D " << ns_2d << " ns per sample ("
+              << (100.0 * (ns_3d - ns_2d) / ns_3d) << "% saved)" << std::endl;
+}
+
+int main()
+{
+    constexpr size_t SAMPLES = 2000000;
+    constexpr float SCALE = 0.01f;
+    constexpr uint8_t OCTAVES = 3;
+    constexpr unsigned LO = 128;
+    constexpr unsigned HI = 176;
+
+    PerlinNoise &pn = PerlinNoise::get_instance();
+    std::cout << std::fixed;
+    std::cout.precision(1);
+
+    // The 2D path must reproduce the 3D one at z = 0, or existing worlds would change
+    size_t mismatches = 0;
+    for (size_t i = 0; i < SAMPLES / 10; ++i)
+    {
+        const float x = (i * 0.0137f) - 1000.0f;
+        const float y = (i * 0.0091f) - 500.0f;
+        mismatches += (pn.perlin(x, y, 0.0f) != pn.perlin2d(x, y));
+    }
+    std::cout << "perlin2d() mismatches against perlin(x, y, 0): " << mismatches << std::endl;
+
+    // Warm up the permutation table and clocks
+    time_samples(SAMPLES / 10, [&](const size_t i) { return pn.perlin2d(i * 0.013f, i * 0.007f); });
+
+    print_result(
+        "perlin",
+        time_samples(SAMPLES, [&](const size_t i) { return pn.perlin(i * 0.013f, i * 0.007f, 0.0f); }),
+        time_samples(SAMPLES, [&](const size_t i) { return pn.perlin2d(i * 0.013f, i * 0.007f); })
+    );
+
+    print_result(
+        "octave_perlin",
+        time_samples(SAMPLES / 3, [&](const size_t i)
+        {
+            return pn.octave_perlin((float)i, 7.0f, 0.0f, SCALE, OCTAVES, LO, HI);
+        }),
+        time_samples(SAMPLES / 3, [&](const size_t i)
+        {
+            return pn.octave_perlin2d((float)i, 7.0f, SCALE, OCTAVES, LO, HI);
+        })
+    );
+
+    // A chunk's heightmap plus its border, as sampled by sample_biome_heights(), using the fastest kernel the
+    // CPU supports
+    constexpr size_t WIDTH = 18;
+    constexpr size_t ROUNDS = 4000;
+    auto samples = std::vector<float>(WIDTH * WIDTH);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ROUNDS; ++i)
+    {
+        pn.octave_perlin_grid(i * 16.0f, 5.0f, WIDTH, WIDTH, SCALE, OCTAVES, LO, HI, samples.data());
+    }
+    auto end = std::chrono::steady_clock::now();
+    sink = samples[0];
+    std::cout << "octave_perlin_grid (" << WIDTH << "x" << WIDTH << "): "
+              << std::chrono::duration<double, std::nano>(end - start).count() / (ROUNDS * samples.size())
+              << " ns per sample" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -25,3 +25,4 @@ extern Biome mount_biome;
 extern Biome ocean_biome;
 
 float sample_biome_height(const Vec2_t point);
+void sample_biome_heights(const Vec2_t origin, const size_t width, const size_t height, float *heights);
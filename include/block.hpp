@@ -1,9 +1,8 @@
 #pragma once
 
 #include "common.hpp"
-#include "mesh.hpp"
 
-enum class BlockType
+enum class BlockType : uint8_t
 {
     AIR,
     DIRT,
@@ -15,6 +14,13 @@ enum class BlockType
     WATER
 };
 
+enum class RenderPass : uint8_t
+{
+    OPAQUE,       // Drawn first, with a shader that never discards fragments
+    ALPHA_TESTED, // Fully transparent texels are discarded, e.g. leaves
+    TRANSLUCENT   // Blended over everything else, back to front, e.g. water
+};
+
 enum BlockFace : uint8_t
 {
     RIGHT  = (1 << 0),
@@ -30,14 +36,8 @@ class Block
 {
 public:
     // Member variables
-    BlockType type;
-    uint8_t faces;
-    std::array<Vertex, 6> top_face;
-    std::array<Vertex, 6> bottom_face;
-    std::array<Vertex, 6> right_face;
-    std::array<Vertex, 6> left_face;
-    std::array<Vertex, 6> front_face;
-    std::array<Vertex, 6> back_face;
+    BlockType type; // The kind of block occupying the cell
+    uint8_t faces;  // Mask of BlockFace values which ought to be rendered
 
     // Special member functions
     Block();
@@ -47,4 +47,8 @@ public:
     Block &operator=(const Block &block) = default;
     Block(Block &&block) = default;
     Block &operator=(Block &&block) = default;
+
+    // General
+    bool operator==(const Block &block) const = default;
+    static RenderPass get_render_pass(const BlockType type);
 };
@@ -3,6 +3,8 @@
 #include "common.hpp"
 #include "constants.hpp"
 #include "block.hpp"
+#include "mesh.hpp"
+#include "utils.hpp"
 
 class BlockFactory
 {
@@ -15,7 +17,18 @@ public:
 
     // General
     static BlockFactory &get_instance();
-    Block make_block(const BlockType type, const uint8_t faces, const Vec3_t world_location) const;
+    void make_face_mesh(
+        std::vector<TerrainVertex> &vertices,
+        const BlockType type,
+        const BlockFace face,
+        const Vec3_t block_location,
+        const Vec3_t size
+    ) const;
+    void make_block_mesh(
+        std::vector<TerrainVertex> &vertices,
+        const Block block,
+        const Vec3_t block_location
+    ) const;
 
 private:
     // Member variables
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "common.hpp"
+#include "constants.hpp"
+#include "block.hpp"
+
+class BlockStorage
+{
+public:
+    // Special member functions
+    BlockStorage();
+    BlockStorage(const Block block);
+    ~BlockStorage() = default;
+    BlockStorage(const BlockStorage &block_storage) = default;
+    BlockStorage &operator=(const BlockStorage &block_storage) = default;
+    BlockStorage(BlockStorage &&block_storage) = default;
+    BlockStorage &operator=(BlockStorage &&block_storage) = default;
+
+    // General
+    Block get(const size_t index) const;
+    void set(const size_t index, const Block block);
+    void fill(const Block block);
+    bool is_uniform() const;
+
+private:
+    // Member variables
+    Block uniform;                 // The value of every block while the storage is uniform
+    uint8_t bits_per_index;        // Width of each packed palette index (0 whilst uniform)
+    std::vector<Block> palette;    // Distinct blocks referenced by indices
+    std::vector<uint64_t> indices; // Bit-packed palette indices, one per block
+
+    // General
+    size_t get_palette_index(const Block block);
+    void repack(const uint8_t bits);
+};
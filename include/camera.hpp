@@ -5,6 +5,12 @@
 #include "settings.hpp"
 #include "chunk_manager.hpp"
 
+struct RayHit
+{
+    Vec3_t block_location;    // World location of the block that was hit
+    Vec3_t adjacent_location; // World location of the cell the ray passed through just before the hit
+};
+
 class Camera
 {
 public:
@@ -25,7 +31,7 @@ public:
     void calculate_view_matrix();
     void update_rotation_from_pointer(const KCWindow &win);
     bool is_chunk_in_visible_radius(const Vec3_t chunk_location) const;
-    std::optional<Block> cast_ray(const uint8_t n_iters = 5) const;
+    std::optional<RayHit> cast_ray(const float max_distance = KC::PLAYER_REACH) const;
 
 private:
     // Member variables
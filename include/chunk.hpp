@@ -2,7 +2,10 @@
 
 #include "common.hpp"
 #include "block.hpp"
+#include "block_storage.hpp"
 #include "block_factory.hpp"
+#include "mesh.hpp"
+#include "mesh_arena.hpp"
 #include "settings.hpp"
 #include "utils.hpp"
 
@@ -12,10 +15,18 @@ public:
     // Member variables
     Vec3_t location;
     bool update_pending;
-    std::weak_ptr<Chunk> tree_ref;
-    std::vector<Vertex> vertices;
+    bool is_edited; // Whether the player has changed any of the chunk's blocks
+    std::optional<MeshRange> mesh_range; // Range of the terrain arena holding the chunk's uploaded mesh
+    std::vector<TerrainVertex> vertices; // Mesh of the chunk, ordered by slice (see Chunk::slice_offsets)
     std::vector<std::vector<uint8_t>> block_heights;
-    std::vector<std::vector<std::vector<Block>>> blocks;
+    BlockStorage blocks; // Palette-compressed CHUNK_SIZE^3 grid of blocks, see Chunk::index()
+    std::array<Chunk*, 6> neighbors; // Loaded face neighbors (or nullptr), see Chunk::get_neighbor_index()
+    std::array<uint32_t, (KC::RENDER_PASSES * KC::CUBE_FACES * KC::CHUNK_SIZE) + 1> slice_offsets; // Start of each slice within vertices, see Chunk::get_slice_index()
+    std::array<uint16_t, KC::CUBE_FACES> dirty_layers; // Per direction, a mask of the layers which need to be remeshed
+    std::array<uint16_t, KC::CHUNK_SIZE * KC::CHUNK_SIZE> opaque_rows_x; // Opaque blocks as rows along x, indexed by (z, y)
+    std::array<uint16_t, KC::CHUNK_SIZE * KC::CHUNK_SIZE> opaque_rows_y; // Opaque blocks as rows along y, indexed by (z, x)
+    std::array<uint8_t, KC::CUBE_FACES> face_connectivity; // Per face, a mask of the faces reachable from it through non-opaque blocks
+    std::array<uint8_t, 4> solid_heights; // Per 8x8 quarter of the chunk's columns, the height up to which every block is opaque
 
     // Special member functions
     Chunk();
@@ -27,7 +38,45 @@ public:
     Chunk &operator=(Chunk &&chunk) = default;
 
     // General
-    void update_mesh();
+    Block get_block(const size_t x, const size_t y, const size_t z) const;
+    std::optional<Block> get_block_relative(const int x, const int y, const int z) const;
+    void set_block(const size_t x, const size_t y, const size_t z, const Block block);
+    void fill(const Block block);
+    Chunk *find_relative(int &x, int &y, int &z);
+    void mark_dirty(const size_t x, const size_t y, const size_t z);
+    void mark_slice_dirty(const size_t direction, const size_t layer);
+    bool is_dirty() const;
+    void update_mesh(const bool is_greedy);
+    void update_dirty_slices(const bool is_greedy);
+    void update_faces(const std::array<int, 3> &min, const std::array<int, 3> &max);
+    bool has_hidden_border_faces(const size_t neighbor_index) const;
+    bool has_faces(const RenderPass pass) const;
+    void get_facing_ranges(
+        const RenderPass pass,
+        const Vec3_t v_eye,
+        std::vector<GLint> &firsts,
+        std::vector<GLsizei> &counts
+    ) const;
     bool operator==(const Chunk &chunk) const;
+    static size_t get_neighbor_index(const size_t axis, const bool is_positive);
+    static BlockFace get_neighbor_face(const size_t neighbor_index);
+    static bool is_occluder(const BlockType type);
+
+private:
+    // General
+    static size_t index(const size_t x, const size_t y, const size_t z);
+    static size_t get_slice_index(const RenderPass pass, const size_t direction, const size_t layer);
+    uint16_t get_opaque_row(const size_t axis, const int layer, const int row) const;
+    void update_face_connectivity();
+    void update_solid_heights();
+    void make_slice_mesh(
+        std::vector<TerrainVertex> &vertices,
+        const std::array<Block, KC::CHUNK_VOLUME> &cells,
+        const std::array<uint16_t, KC::CHUNK_SIZE * KC::CHUNK_SIZE> &face_rows,
+        const RenderPass pass,
+        const size_t direction,
+        const size_t layer,
+        const bool is_greedy
+    ) const;
 };
 
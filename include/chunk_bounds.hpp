@@ -0,0 +1,36 @@
+#pragma once
+
+#include "common.hpp"
+#include "constants.hpp"
+#include "chunk.hpp"
+#include "chunk_map.hpp"
+
+class ChunkBounds
+{
+public:
+    // Member variables
+    std::vector<float> min_x; // Bounding box of each chunk, one array per component so that
+    std::vector<float> min_y; // culling tests can be evaluated across many chunks at once
+    std::vector<float> min_z;
+    std::vector<float> max_x;
+    std::vector<float> max_y;
+    std::vector<float> max_z;
+    std::vector<Chunk*> chunks; // The chunk that each bounding box belongs to
+
+    // Special member functions
+    ChunkBounds() = default;
+    ~ChunkBounds() = default;
+    ChunkBounds(const ChunkBounds &chunk_bounds) = delete;
+    ChunkBounds &operator=(const ChunkBounds &chunk_bounds) = delete;
+    ChunkBounds(ChunkBounds &&chunk_bounds) = delete;
+    ChunkBounds &operator=(ChunkBounds &&chunk_bounds) = delete;
+
+    // General
+    size_t size() const;
+    void insert(Chunk *chunk);
+    void erase(const ChunkMapKey &chunk_key);
+
+private:
+    // Member variables
+    std::unordered_map<ChunkMapKey, size_t, ChunkMapHash> slots; // Index of each chunk's bounding box
+};
@@ -5,6 +5,7 @@
 #include "block_factory.hpp"
 #include "settings.hpp"
 #include "biome.hpp"
+#include "heightmap_cache.hpp"
 
 class ChunkFactory
 {
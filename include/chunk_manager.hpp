@@ -4,6 +4,13 @@
 #include "settings.hpp"
 #include "chunk_factory.hpp"
 #include "chunk_map.hpp"
+#include "chunk_bounds.hpp"
+#include "frustum.hpp"
+#include "occlusion_buffer.hpp"
+#include "mesh_arena.hpp"
+#include "pending_writes.hpp"
+#include "structure_template.hpp"
+#include "thread_pool.hpp"
 
 // TODO: Don't like
 enum Result
@@ -14,12 +21,32 @@ enum Result
     SUCCESS
 };
 
+struct CullingStats
+{
+    size_t chunks;           // Chunks tested
+    size_t frustum_culled;   // Chunks outside of the view frustum
+    size_t cave_culled;      // Chunks that can't be seen through the non-opaque blocks around the camera
+    size_t occlusion_culled; // Chunks hidden behind solid terrain
+};
+
+struct GeneratedChunk
+{
+    std::shared_ptr<Chunk> chunk;        // The generated (and meshed) chunk
+    std::vector<DeferredBlock> deferred; // Blocks that belong to neighboring chunks, see ChunkManager::apply_deferred_blocks()
+    bool is_greedy;                      // Whether the chunk was meshed with the greedy mesher
+};
+
 class ChunkManager
 {
 public:
-    ChunkMap GCL;         // Global Chunk List (list of chunks actively loaded in memory)
-    ChunkMap chunk_cache; // List of chunks that player has edited
-    Mesh terrain_mesh;    // Mesh that encapsulates all interactable blocks
+    ChunkMap GCL;                     // Global Chunk List (list of chunks actively loaded in memory)
+    ChunkMap chunk_cache;             // Chunks that the player has edited which have since been unloaded
+    ChunkBounds chunk_bounds;         // Bounding boxes of the GCL's chunks, packed for culling
+    OcclusionBuffer occlusion_buffer; // Depth buffer that solid terrain is rasterized into when culling
+    CullingStats culling_stats;       // How many chunks each culling pass removed on the last frame
+    MeshArena terrain_arena;          // Vertex buffer shared by every chunk's mesh
+    PendingWrites pending_writes;     // Structure blocks waiting for the chunk they belong to
+    std::map<std::string, StructureTemplate> structures; // Structure templates loaded from res/structures, keyed by name
 
     // Special member functions
     ChunkManager(const ChunkManager &chunk_mgr) = delete;
@@ -30,7 +57,8 @@ public:
     // General
     static ChunkManager &get_instance();
 
-    //std::optional<Block&> get_block(const Vec3_t world_location) const;
+    std::optional<Block> get_block(const Vec3_t world_location) const;
+    Result edit_block(const Vec3_t world_location, const BlockType type);
     Result add_block(
         std::shared_ptr<Chunk> &chunk,
         const BlockType type,
@@ -38,11 +66,46 @@ public:
         const bool overwrite = false
     ) const;
     Result remove_block(std::shared_ptr<Chunk> &chunk, const Vec3_t block_location) const;
-    ChunkMap plant_tree(std::shared_ptr<Chunk> &chunk, const Vec3_t root_location);
-    ChunkMap plant_trees(std::shared_ptr<Chunk> &chunk, const float density = 0.0033f);
+    ChunkMap set_blocks(const std::vector<DeferredBlock> &block_list, const bool is_structure = false);
+    ChunkMap fill_box(const Vec3_t world_min, const Vec3_t world_max, const BlockType type);
+    ChunkMap stamp_blocks(const StructureTemplate &structure, const Vec3_t world_location);
+    std::vector<DeferredBlock> plant_trees(std::shared_ptr<Chunk> &chunk, const float density = 0.0033f) const;
     void bind_terrain_mesh();
+    void mark_chunks_dirty(const ChunkMap &chunks);
+    void get_draw_list(
+        const Frustum &frustum,
+        const Mat4_t &m_view_proj,
+        const Vec3_t v_eye,
+        std::vector<Chunk*> &draw_list
+    );
+    void load_chunk(const std::shared_ptr<Chunk> &chunk);
+    void unload_chunk(const Vec3_t chunk_location);
+    GeneratedChunk generate_chunk(
+        const Vec3_t chunk_location,
+        const std::shared_ptr<Chunk> &cached,
+        const bool is_greedy
+    ) const;
+    void insert_generated_chunk(GeneratedChunk &generated);
+    std::shared_ptr<Chunk> find_or_generate_chunk(const Vec3_t chunk_location);
+    void queue_chunk(const Vec3_t chunk_location);
+    void stop_workers();
+    bool is_chunk_queued(const Vec3_t chunk_location) const;
+    size_t get_queued_count() const;
+    size_t get_queue_capacity() const;
+    std::vector<GeneratedChunk> take_generated_chunks();
+    std::pair<int, int> get_column_z_range(const ChunkColumn column) const;
+    ChunkMap apply_deferred_blocks(const std::vector<DeferredBlock> &deferred_list);
+    bool apply_pending_blocks(std::shared_ptr<Chunk> &chunk) const;
 
 private:
+    // Member variables
+    std::unordered_set<ChunkMapKey, ChunkMapHash> in_flight; // Chunks queued but not yet collected (main thread only)
+    ChunkMap dirty_chunks;                                   // Loaded chunks whose meshes need updating this frame
+    std::unordered_map<ChunkColumn, std::pair<int, int>, ChunkColumnHash> edited_z_ranges; // Per column, the lowest and highest chunk that the player has edited or exposed
+    std::vector<GeneratedChunk> generated_chunks;            // Chunks finished by the workers
+    std::mutex generated_mutex;                              // Guards generated_chunks
+    ThreadPool workers;                                      // Must be destroyed before the members above
+
     // Special member functions
     ChunkManager();
     ~ChunkManager();
@@ -54,9 +117,25 @@ private:
         Vec3_t &actual_chunk_location,
         Vec3_t &actual_block_location
     ) const;
-    std::shared_ptr<Chunk> add_block_relative(
-        std::shared_ptr<Chunk> &chunk,
-        const BlockType type,
-        const Vec3_t block_location
+    std::shared_ptr<Chunk> take_cached_chunk(const ChunkMapKey &chunk_key);
+    void widen_edited_z_range(const Vec3_t chunk_location);
+    void expose_border_faces(Chunk &chunk, const size_t axis, const int direction) const;
+    void expose_neighbor_faces(std::shared_ptr<Chunk> &chunk, const Vec3_t block_location) const;
+    void cull_hidden_chunks(const Frustum &frustum, const Vec3_t v_eye, std::vector<uint8_t> &is_visible) const;
+    void cull_occluded_chunks(
+        const Mat4_t &m_view_proj,
+        const std::vector<uint8_t> &is_in_frustum,
+        std::vector<uint8_t> &is_visible
     );
+    void collect_dirty_chunks(
+        const std::shared_ptr<Chunk> &chunk,
+        const uint8_t touched_borders,
+        ChunkMap &dirty_chunks
+    ) const;
+    bool write_blocks(
+        std::shared_ptr<Chunk> &chunk,
+        const std::vector<BlockEdit> &edits,
+        const bool is_structure,
+        uint8_t &touched_borders
+    ) const;
 };
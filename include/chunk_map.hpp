@@ -5,8 +5,12 @@
 
 struct ChunkMapKey
 {
-    int x, y, z;
+    int x = 0, y = 0, z = 0;
 
+    ChunkMapKey() = default;
+    ChunkMapKey(const int x, const int y, const int z) :
+        x(x), y(y), z(z)
+    {}
     ChunkMapKey(const Vec3_t location)
     {
         x = (int)location.x;
@@ -14,80 +18,104 @@ struct ChunkMapKey
         z = (int)location.z;
     }
     bool operator==(const ChunkMapKey &chunk_key) const = default;
+
+    // Packs each axis into 21 bits, which covers over a million chunks in either direction
+    uint64_t pack() const
+    {
+        constexpr uint64_t mask = (1 << 21) - 1;
+        return ((uint64_t)x & mask) | (((uint64_t)y & mask) << 21) | (((uint64_t)z & mask) << 42);
+    }
+
+    static ChunkMapKey unpack(const uint64_t packed)
+    {
+        // Shift each field to the top of the word so that it is sign extended on the way back down
+        return ChunkMapKey(
+            (int)((int64_t)(packed << 43) >> 43),
+            (int)((int64_t)(packed << 22) >> 43),
+            (int)((int64_t)(packed << 1) >> 43)
+        );
+    }
 };
 
 struct ChunkMapHash
 {
     size_t operator()(const ChunkMapKey &chunk_key) const
     {
-        return (chunk_key.x * 73856093) ^
-               (chunk_key.y * 19349663) ^
-               (chunk_key.z * 83492791);
+        return hash64(chunk_key.pack());
     }
 };
 
-class ChunkMap
+struct ChunkColumn
 {
-public:
-    std::unordered_map<ChunkMapKey, std::shared_ptr<Chunk>, ChunkMapHash> map;
+    int x, y;
 
-    auto begin()
-    {
-        return map.begin();
-    }
-
-    auto end()
-    {
-        return map.end();
-    }
-
-    auto begin() const
-    {
-        return map.begin();
-    }
+    bool operator==(const ChunkColumn &chunk_column) const = default;
+};
 
-    auto end() const
+struct ChunkColumnHash
+{
+    size_t operator()(const ChunkColumn &chunk_column) const
     {
-        return map.end();
+        return hash64(((uint64_t)(uint32_t)chunk_column.x << 32) | (uint32_t)chunk_column.y);
     }
+};
 
+class ChunkMap
+{
+public:
+    // Special member functions
+    ChunkMap() = default;
+    ~ChunkMap() = default;
+    ChunkMap(const ChunkMap &chunk_map) = default;
+    ChunkMap &operator=(const ChunkMap &chunk_map) = default;
+    ChunkMap(ChunkMap &&chunk_map) = default;
+    ChunkMap &operator=(ChunkMap &&chunk_map) = default;
+
+    // General
     auto values()
     {
-        return map | std::views::values;
+        return this->chunks | std::views::filter([](const auto &chunk) { return chunk != nullptr; });
     }
 
     auto values() const
     {
-        return map | std::views::values;
+        return this->chunks | std::views::filter([](const auto &chunk) { return chunk != nullptr; });
     }
 
-    void clear()
+    auto keys() const
     {
-        return map.clear();
+        return this->keys_packed
+            | std::views::filter([](const uint64_t packed) { return packed != EMPTY; })
+            | std::views::transform(ChunkMapKey::unpack);
     }
 
-    void insert(const std::shared_ptr<Chunk> &chunk)
-    {
-        map.emplace(ChunkMapKey(chunk->location), chunk);
-    }
-
-    template<typename Iter>
-    void insert(Iter begin, Iter end)
-    {
-        for (auto it = begin; it != end; ++it)
-        {
-            map.insert(*it);
-        }
-    }
+    size_t size() const;
+    void clear();
+    void insert(const std::shared_ptr<Chunk> &chunk);
+    bool erase(const ChunkMapKey &chunk_key);
+    std::shared_ptr<Chunk> find(const ChunkMapKey &chunk_key) const;
+    bool contains(const ChunkMapKey &chunk_key) const;
 
     std::shared_ptr<Chunk> find(const Vec3_t &chunk_location) const
     {
-        auto needle = map.find(ChunkMapKey(chunk_location));
-        return (needle == map.end()) ? nullptr : needle->second;
+        return find(ChunkMapKey(chunk_location));
     }
 
     bool contains(const Vec3_t &chunk_location) const
     {
-        return map.contains(ChunkMapKey(chunk_location));
+        return contains(ChunkMapKey(chunk_location));
     }
+
+private:
+    // Bit 63 of a packed key is never set, so this can't collide with a real key
+    static constexpr uint64_t EMPTY = UINT64_MAX;
+
+    // Member variables
+    std::vector<uint64_t> keys_packed;          // Open-addressed table of packed keys. Size is zero or a power of two
+    std::vector<std::shared_ptr<Chunk>> chunks; // The chunk of each slot, kept apart so that probing stays compact
+    size_t count = 0;                           // Amount of occupied slots
+
+    // General
+    size_t get_slot(const uint64_t packed) const;
+    void grow();
 };
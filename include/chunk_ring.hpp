@@ -0,0 +1,39 @@
+#pragma once
+
+#include "common.hpp"
+#include "constants.hpp"
+#include "camera.hpp"
+#include "chunk_map.hpp"
+
+class ChunkRing
+{
+public:
+    // Special member functions
+    ChunkRing() = default;
+    ~ChunkRing() = default;
+    ChunkRing(const ChunkRing &chunk_ring) = default;
+    ChunkRing &operator=(const ChunkRing &chunk_ring) = default;
+    ChunkRing(ChunkRing &&chunk_ring) = default;
+    ChunkRing &operator=(ChunkRing &&chunk_ring) = default;
+
+    // General
+    bool update(
+        const Camera &camera,
+        std::vector<ChunkColumn> &exposed,
+        std::vector<ChunkColumn> &hidden
+    );
+    std::optional<ChunkColumn> get_center() const;
+    int get_radius() const;
+
+private:
+    // Member variables
+    std::optional<ChunkColumn> center; // Column that the camera occupied during the last update
+    int radius = 0;                    // Render distance during the last update (in chunks)
+
+    // General
+    static std::optional<std::pair<int, int>> get_row_span(
+        const std::optional<ChunkColumn> center,
+        const int radius,
+        const int y
+    );
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "common.hpp"
+#include "constants.hpp"
+#include "camera.hpp"
+#include "chunk_map.hpp"
+
+struct ChunkRequest
+{
+    ChunkMapKey key; // Location of the requested chunk
+    float priority;  // Lower values are loaded first
+
+    bool operator<(const ChunkRequest &request) const
+    {
+        // Inverted so that the std heap algorithms yield the lowest priority value first
+        return this->priority > request.priority;
+    }
+};
+
+class ChunkScheduler
+{
+public:
+    // Special member functions
+    ChunkScheduler() = default;
+    ~ChunkScheduler() = default;
+    ChunkScheduler(const ChunkScheduler &chunk_scheduler) = delete;
+    ChunkScheduler &operator=(const ChunkScheduler &chunk_scheduler) = delete;
+    ChunkScheduler(ChunkScheduler &&chunk_scheduler) = default;
+    ChunkScheduler &operator=(ChunkScheduler &&chunk_scheduler) = default;
+
+    // General
+    void push(const Camera &camera, const Vec3_t chunk_location);
+    std::optional<Vec3_t> pop(const Camera &camera);
+    void reprioritize(const Camera &camera);
+    bool is_stale(const Camera &camera) const;
+
+private:
+    // Member variables
+    std::vector<ChunkRequest> heap;                        // Pending requests, ordered as a binary heap
+    std::unordered_set<ChunkMapKey, ChunkMapHash> pending; // Keys of every pending request
+    Vec3_t v_look_dir = KC::v_fwd;                         // Look direction used by the last reprioritization
+
+    // General
+    static float get_priority(const Camera &camera, const ChunkMapKey key);
+};
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <memory>
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <algorithm>
 #include <array>
@@ -23,6 +24,10 @@
 #include <random>
 #include <thread>
 #include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <bit>
 
 // C APIs
 #include <cmath>
@@ -15,16 +15,23 @@ namespace KC
 
     // General constants
     static constexpr unsigned CHUNK_SIZE = 16;
+    static constexpr unsigned CHUNK_VOLUME = CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE;
     static constexpr unsigned CUBE_FACES = 6;
+    static constexpr unsigned RENDER_PASSES = 3; // See RenderPass
     static constexpr unsigned TEX_ATLAS_NCOLS = 16;
+    static constexpr unsigned TERRAIN_ARENA_CAPACITY = 1 << 20; // Initial size of the terrain VBO (in vertices)
     static constexpr auto SEC_AS_MS = duration_cast<milliseconds>(seconds(1));
 
     // Normalized scaling factors
     static constexpr float CAMERA_SPEED_FACTOR = 0.5f;
     static constexpr float PLAYER_SPEED_FACTOR = 7.0f;
+    static constexpr float VIEW_PRIORITY_WEIGHT = 1.0f; // Chunks behind the camera load as if (1 + weight) times further away
+    static constexpr float REPRIORITIZE_COS_THRESHOLD = 0.866f; // Reprioritize chunk loads after turning ~30 degrees
 
     // Measurements (1 block => 1 unit of measurement)
     static constexpr unsigned PLAYER_HEIGHT = 2;
     static constexpr unsigned MAX_BLOCK_HEIGHT = UINT8_MAX;
     static constexpr unsigned SEA_LEVEL = (unsigned)((MAX_BLOCK_HEIGHT + 1) / 2);
+    static constexpr unsigned STRUCTURE_HEADROOM = 10; // Tallest structure above the surface (tree + slope margin)
+    static constexpr float PLAYER_REACH = 6.0f; // Furthest distance from the camera at which blocks can be edited
 };
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "common.hpp"
+#include "chunk_bounds.hpp"
+
+class Frustum
+{
+public:
+    // Member variables
+    std::array<Vec4_t, 6> planes; // Left, right, bottom, top, near, far. Points inside satisfy dot(plane, (p, 1)) >= 0
+
+    // Special member functions
+    Frustum();
+    Frustum(const Mat4_t &m_view_proj);
+    ~Frustum() = default;
+    Frustum(const Frustum &frustum) = default;
+    Frustum &operator=(const Frustum &frustum) = default;
+    Frustum(Frustum &&frustum) = default;
+    Frustum &operator=(Frustum &&frustum) = default;
+
+    // General
+    bool intersects_box(const Vec3_t box_min, const Vec3_t box_max) const;
+    void cull(const ChunkBounds &bounds, std::vector<uint8_t> &is_visible) const;
+};
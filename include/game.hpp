@@ -8,6 +8,8 @@
 #include "shader.hpp"
 #include "chunk_factory.hpp"
 #include "chunk_manager.hpp"
+#include "chunk_scheduler.hpp"
+#include "chunk_ring.hpp"
 #include "skybox.hpp"
 #include "player.hpp"
 #include "perlin_noise.hpp"
@@ -34,10 +36,11 @@ private:
 
     // TODO: Not a fan of having these here...
     Shader block_shader;
+    Shader alpha_tested_shader;
     Shader skybox_shader;
 
     // General
-    void generate_terrain(Camera &camera, std::queue<ChunkMapKey> &chunk_queue);
+    void generate_terrain(Camera &camera, ChunkScheduler &chunk_scheduler, ChunkRing &chunk_ring);
     void apply_physics(Camera &camera);
     void process_events(Camera &camera);
     void render_frame(Camera &camera, Mvp &mvp, SkyBox &skybox);
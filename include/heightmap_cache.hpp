@@ -0,0 +1,36 @@
+#pragma once
+
+#include "common.hpp"
+#include "constants.hpp"
+#include "biome.hpp"
+#include "chunk_map.hpp"
+
+struct Heightmap
+{
+    std::array<uint8_t, KC::CHUNK_SIZE * KC::CHUNK_SIZE> heights; // Surface height of each block column, row by row
+};
+
+class HeightmapCache
+{
+public:
+    // Special member functions
+    HeightmapCache(const HeightmapCache &heightmap_cache) = delete;
+    HeightmapCache &operator=(const HeightmapCache &heightmap_cache) = delete;
+    HeightmapCache(HeightmapCache &&heightmap_cache) = delete;
+    HeightmapCache &operator=(HeightmapCache &&heightmap_cache) = delete;
+
+    // General
+    static HeightmapCache &get_instance();
+    std::shared_ptr<const Heightmap> get(const ChunkColumn column);
+    void get_bordered(const ChunkColumn column, std::vector<std::vector<uint8_t>> &block_heights);
+    void evict_outside(const ChunkColumn center, const int radius);
+
+private:
+    // Member variables
+    std::unordered_map<ChunkColumn, std::shared_ptr<const Heightmap>, ChunkColumnHash> heightmaps;
+    std::mutex heightmaps_mutex; // Guards heightmaps, since chunks are generated by worker threads
+
+    // Special member functions
+    HeightmapCache() = default;
+    ~HeightmapCache() = default;
+};
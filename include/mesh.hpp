@@ -29,9 +29,53 @@ struct Vertex
     AttribRgb rgb;
 };
 
+/*
+ * Terrain vertex packed into 32 bits, decoded by res/shader/block.vs
+ *
+ * | 31..28 | 27..20 | 19..18 | 17..15 | 14..10 |  9..5  |  4..0  |
+ * | light  |  tile  | corner |  face  |   z    |   y    |   x    |
+ */
+struct TerrainVertex
+{
+    uint32_t data;
+};
+
 struct Mesh
 {
     ID vao; // Vertex Attribute Object ID
     ID vbo; // Vertex Buffer Object ID
     std::vector<Vertex> vertices; // Vertex data
 };
+
+/**
+ * @brief Packs the attributes of a terrain vertex into a single 32-bit word.
+ * @since 16-10-2026
+ * @param[in] x The x coordinate of the vertex relative to its chunk, in the range [0, KC::CHUNK_SIZE]
+ * @param[in] y The y coordinate of the vertex relative to its chunk, in the range [0, KC::CHUNK_SIZE]
+ * @param[in] z The z coordinate of the vertex relative to its chunk, in the range [0, KC::CHUNK_SIZE]
+ * @param[in] face The index of the face's direction (bit position of its BlockFace value)
+ * @param[in] corner Which corner of the face the vertex belongs to (bit 0 = far along u, bit 1 = far along v)
+ * @param[in] tile The index of the texture atlas tile, counted row by row
+ * @param[in] light The light level of the vertex, in the range [0, 15]
+ * @returns The packed vertex
+ */
+static inline TerrainVertex make_terrain_vertex(
+    const unsigned x,
+    const unsigned y,
+    const unsigned z,
+    const unsigned face,
+    const unsigned corner,
+    const unsigned tile,
+    const unsigned light
+)
+{
+    return TerrainVertex{
+        ((x      & 0x1F) << 0)  |
+        ((y      & 0x1F) << 5)  |
+        ((z      & 0x1F) << 10) |
+        ((face   & 0x07) << 15) |
+        ((corner & 0x03) << 18) |
+        ((tile   & 0xFF) << 20) |
+        ((light  & 0x0F) << 28)
+    };
+}
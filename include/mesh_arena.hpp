@@ -0,0 +1,40 @@
+#pragma once
+
+#include "common.hpp"
+#include "mesh.hpp"
+
+struct MeshRange
+{
+    size_t offset;   // Index of the range's first vertex within the arena
+    size_t count;    // Amount of vertices currently uploaded to the range
+    size_t capacity; // Amount of vertices reserved for the range
+};
+
+class MeshArena
+{
+public:
+    // Member variables
+    ID vao; // Vertex Attribute Object ID
+    ID vbo; // Vertex Buffer Object ID
+
+    // Special member functions
+    MeshArena(const size_t capacity);
+    ~MeshArena();
+    MeshArena(const MeshArena &mesh_arena) = delete;
+    MeshArena &operator=(const MeshArena &mesh_arena) = delete;
+    MeshArena(MeshArena &&mesh_arena) = delete;
+    MeshArena &operator=(MeshArena &&mesh_arena) = delete;
+
+    // General
+    void upload(std::optional<MeshRange> &range, const std::vector<TerrainVertex> &vertices);
+    void release(std::optional<MeshRange> &range);
+
+private:
+    // Member variables
+    size_t capacity;                       // Size of the VBO (in vertices)
+    std::map<size_t, size_t> free_ranges;  // Unallocated ranges as offset => count, kept coalesced
+
+    // General
+    MeshRange allocate(const size_t count);
+    void grow(const size_t min_capacity);
+};
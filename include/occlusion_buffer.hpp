@@ -0,0 +1,34 @@
+#pragma once
+
+#include "common.hpp"
+
+class OcclusionBuffer
+{
+public:
+    // Member variables
+    size_t width;
+    size_t height;
+    std::vector<float> depths; // Nearest occluder depth (NDC) of each pixel, row by row
+
+    // Special member functions
+    OcclusionBuffer(const size_t width = 256, const size_t height = 128);
+    ~OcclusionBuffer() = default;
+    OcclusionBuffer(const OcclusionBuffer &occlusion_buffer) = default;
+    OcclusionBuffer &operator=(const OcclusionBuffer &occlusion_buffer) = default;
+    OcclusionBuffer(OcclusionBuffer &&occlusion_buffer) = default;
+    OcclusionBuffer &operator=(OcclusionBuffer &&occlusion_buffer) = default;
+
+    // General
+    void clear(const Mat4_t &m_view_proj, const float znear);
+    void add_occluder(const Vec3_t box_min, const Vec3_t box_max);
+    bool is_box_visible(const Vec3_t box_min, const Vec3_t box_max) const;
+
+private:
+    // Member variables
+    Mat4_t m_view_proj;
+    float znear;
+
+    // General
+    bool project_box(const Vec3_t box_min, const Vec3_t box_max, std::array<Vec3_t, 8> &corners) const;
+    void rasterize_polygon(const Vec3_t *points, const size_t count, const float depth);
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "common.hpp"
+#include "constants.hpp"
+#include "block.hpp"
+#include "chunk_map.hpp"
+
+struct DeferredBlock
+{
+    Vec3_t chunk_location; // Location of the chunk that the block belongs to
+    Vec3_t block_location; // Location of the block relative to chunk_location
+    BlockType type;
+
+    DeferredBlock(const Vec3_t chunk_location, const Vec3_t block_location, const BlockType type) :
+        chunk_location(chunk_location),
+        block_location(block_location),
+        type(type)
+    {}
+};
+
+struct BlockEdit
+{
+    Vec3_t block_location; // Location of the block relative to the chunk being edited
+    BlockType type;
+};
+
+class PendingWrites
+{
+public:
+    // Special member functions
+    PendingWrites() = default;
+    ~PendingWrites() = default;
+    PendingWrites(const PendingWrites &pending_writes) = delete;
+    PendingWrites &operator=(const PendingWrites &pending_writes) = delete;
+    PendingWrites(PendingWrites &&pending_writes) = delete;
+    PendingWrites &operator=(PendingWrites &&pending_writes) = delete;
+
+    // General
+    static bool takes_precedence(const BlockType type, const BlockType existing);
+    void add(const DeferredBlock &deferred);
+    std::vector<DeferredBlock> get(const Vec3_t chunk_location) const;
+    void evict_outside(const ChunkColumn center, const int radius);
+
+private:
+    // Member variables
+    std::unordered_map<ChunkMapKey, std::unordered_map<uint16_t, BlockType>, ChunkMapHash> writes;
+    mutable std::mutex writes_mutex; // Guards writes, since chunks are generated by worker threads
+
+    // General
+    static uint8_t get_precedence(const BlockType type);
+};
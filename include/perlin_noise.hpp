@@ -24,17 +24,84 @@ public:
         const unsigned lo,
         const unsigned hi
     ) const;
+    float perlin2d(const float x, const float y) const;
+    float octave_perlin2d(
+        const float x,
+        const float y,
+        const float scale,
+        const uint8_t octaves,
+        const unsigned lo,
+        const unsigned hi
+    ) const;
+    void octave_perlin_grid(
+        const float x,
+        const float y,
+        const size_t width,
+        const size_t height,
+        const float scale,
+        const uint8_t octaves,
+        const unsigned lo,
+        const unsigned hi,
+        float *samples
+    ) const;
 
 private:
     // Member variables
     std::vector<int> permutations_table;
 
+    // Evaluates octave_perlin2d() for __count__ points given by their x and y components
+    using BatchKernel = void (PerlinNoise::*)(
+        const float *xs,
+        const float *ys,
+        const size_t count,
+        const float scale,
+        const uint8_t octaves,
+        const unsigned lo,
+        const unsigned hi,
+        float *samples
+    ) const;
+    BatchKernel batch_kernel; // Fastest kernel supported by the CPU, selected at construction
+
     // Special member functions
     PerlinNoise();
     ~PerlinNoise() = default;
 
     // General member functions
     static float gradient(const int hash, const float x, const float y, const float z);
+    static float gradient2d(const int hash, const float x, const float y);
     static float lerp(const float t, const float a, const float b);
     static float fade(const float t);
+
+    void octave_perlin_batch_scalar(
+        const float *xs,
+        const float *ys,
+        const size_t count,
+        const float scale,
+        const uint8_t octaves,
+        const unsigned lo,
+        const unsigned hi,
+        float *samples
+    ) const;
+#if defined(__x86_64__) || defined(__i386__)
+    void octave_perlin_batch_sse41(
+        const float *xs,
+        const float *ys,
+        const size_t count,
+        const float scale,
+        const uint8_t octaves,
+        const unsigned lo,
+        const unsigned hi,
+        float *samples
+    ) const;
+    void octave_perlin_batch_avx2(
+        const float *xs,
+        const float *ys,
+        const size_t count,
+        const float scale,
+        const uint8_t octaves,
+        const unsigned lo,
+        const unsigned hi,
+        float *samples
+    ) const;
+#endif
 };
@@ -3,6 +3,7 @@
 #include "common.hpp"
 #include "constants.hpp"
 #include "mesh.hpp"
+#include "block.hpp"
 #include "camera.hpp"
 
 enum class MovementMode
@@ -28,6 +29,7 @@ public:
     Vec3_t v_vel;
     Vec3_t v_jump;
     MovementMode curr_move_mode;
+    BlockType held_block; // The type of block the player places
 
     // Special member functions
     Player(const Player &player) = delete;
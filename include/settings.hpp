@@ -21,6 +21,10 @@ public:
     size_t render_distance = 10;  // (in chunks)
     unsigned long seed = 12345UL;
     unsigned tgt_fps = 60;
+    bool greedy_meshing = true;    // Merge coplanar faces of the same block type when meshing chunks
+    bool cave_culling = true;      // Skip drawing chunks that can't be seen through the non-opaque blocks around the camera
+    bool occlusion_culling = true; // Skip drawing chunks hidden behind solid terrain, see OcclusionBuffer
+    unsigned worker_threads = std::max(std::thread::hardware_concurrency(), 2U) - 1; // Chunk generation threads (read at startup)
     // TODO: Implement
     // bool cap_fps = true;
     bool is_running = true;
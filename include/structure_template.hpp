@@ -0,0 +1,39 @@
+#pragma once
+
+#include "common.hpp"
+#include "constants.hpp"
+#include "block.hpp"
+#include "pending_writes.hpp"
+
+class StructureTemplate
+{
+public:
+    // Member variables
+    std::array<int, 3> size;        // Dimensions of the template's box (x, y, z)
+    std::array<int, 3> anchor;      // Cell of the box which sits on the block that the structure is placed at
+    std::vector<BlockType> palette; // Block types used by the template. Index 0 (as well as AIR) leaves the existing block untouched
+    std::vector<uint8_t> cells;     // Palette index of each cell within the box, x fastest
+
+    // Special member functions
+    StructureTemplate();
+    StructureTemplate(const std::filesystem::path path);
+    ~StructureTemplate() = default;
+    StructureTemplate(const StructureTemplate &structure) = default;
+    StructureTemplate &operator=(const StructureTemplate &structure) = default;
+    StructureTemplate(StructureTemplate &&structure) = default;
+    StructureTemplate &operator=(StructureTemplate &&structure) = default;
+
+    // General
+    bool is_empty() const;
+    void stamp(
+        const Vec3_t chunk_location,
+        const Vec3_t root_location,
+        std::vector<BlockEdit> &edits,
+        std::vector<DeferredBlock> &deferred_list
+    ) const;
+    static std::map<std::string, StructureTemplate> load_all(const std::filesystem::path directory);
+
+private:
+    // General
+    static std::optional<BlockType> parse_block_type(const std::string &name);
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "common.hpp"
+
+class ThreadPool
+{
+public:
+    // Special member functions
+    ThreadPool(const unsigned n_workers);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &thread_pool) = delete;
+    ThreadPool &operator=(const ThreadPool &thread_pool) = delete;
+    ThreadPool(ThreadPool &&thread_pool) = delete;
+    ThreadPool &operator=(ThreadPool &&thread_pool) = delete;
+
+    // General
+    void submit(std::function<void()> task);
+    void stop();
+    size_t size() const;
+
+private:
+    // Member variables
+    std::vector<std::thread> workers;        // Threads that execute submitted tasks
+    std::queue<std::function<void()>> tasks; // Tasks waiting to be picked up by a worker
+    std::mutex tasks_mutex;                  // Guards tasks and is_stopping
+    std::condition_variable tasks_cv;        // Signalled when a task is submitted or the pool is stopping
+    bool is_stopping;                        // Set when the pool is being destroyed
+
+    // General
+    void worker_loop();
+};
@@ -22,6 +22,19 @@ static inline uint32_t hash32(const uint32_t x)
     return _x;
 }
 
+static inline uint64_t hash64(const uint64_t x)
+{
+    uint64_t _x = x;
+
+    _x ^= _x >> 33;
+    _x *= 0xFF51AFD7ED558CCD;
+    _x ^= _x >> 33;
+    _x *= 0xC4CEB9FE1A85EC53;
+    _x ^= _x >> 33;
+
+    return _x;
+}
+
 static inline uint32_t world_hash(const Vec3_t chunk_location, const Vec3_t block_location)
 {
     Settings &settings = Settings::get_instance();
@@ -28,24 +28,26 @@ struct KCWindow
 
 enum KeyAction : uint64_t
 {
-    PLYR_FWD     = (1 << 0),
-    PLYR_BACK    = (1 << 1),
-    PLYR_LEFT    = (1 << 2),
-    PLYR_RIGHT   = (1 << 3),
-    PLYR_UP      = (1 << 4),
-    PLYR_DOWN    = (1 << 5),
-    EXIT_GAME    = (1 << 6),
+    PLYR_FWD      = (1 << 0),
+    PLYR_BACK     = (1 << 1),
+    PLYR_LEFT     = (1 << 2),
+    PLYR_RIGHT    = (1 << 3),
+    PLYR_UP       = (1 << 4),
+    PLYR_DOWN     = (1 << 5),
+    EXIT_GAME     = (1 << 6),
+    TOGGLE_MESHER = (1 << 7),
 };
 extern uint64_t key_mask;
 
 static auto key_binds = std::map<KeySym, KeyAction>{
-    { XK_w,             KeyAction::PLYR_FWD   },
-    { XK_s,             KeyAction::PLYR_BACK  },
-    { XK_a,             KeyAction::PLYR_LEFT  },
-    { XK_d,             KeyAction::PLYR_RIGHT },
-    { XK_space,         KeyAction::PLYR_UP    },
-    { XK_BackSpace,     KeyAction::PLYR_DOWN  },
-    { XK_q,             KeyAction::EXIT_GAME  }
+    { XK_w,             KeyAction::PLYR_FWD      },
+    { XK_s,             KeyAction::PLYR_BACK     },
+    { XK_a,             KeyAction::PLYR_LEFT     },
+    { XK_d,             KeyAction::PLYR_RIGHT    },
+    { XK_space,         KeyAction::PLYR_UP       },
+    { XK_BackSpace,     KeyAction::PLYR_DOWN     },
+    { XK_q,             KeyAction::EXIT_GAME     },
+    { XK_g,             KeyAction::TOGGLE_MESHER }
 };
 
 typedef GLXContext (*glXCreateContextAttribsARBProc)(
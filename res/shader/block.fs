@@ -1,17 +1,22 @@
 #version 330 core
 
 in vec2 tex_coords;
+flat in vec2 tile;
+in float light;
 out vec4 frag_color;
 
 uniform sampler2D texels;
 
+const float TILE_SIZE = 1.0 / 16.0;
+const float UV_PAD = 0.005;
+
+// Used for opaque and translucent faces. Since it never discards fragments, early depth testing stays enabled
+// (alpha-tested faces use block_alpha_tested.fs instead)
 void main()
 {
-    vec4 tex_color = texture(texels, tex_coords);
-    if (tex_color.a < 0.1)
-    {
-        discard;
-    }
+    // Repeat the atlas tile once per block so that merged faces aren't stretched
+    vec2 uv = tile + UV_PAD + fract(tex_coords) * (TILE_SIZE - 2.0 * UV_PAD);
+    vec4 tex_color = texture(texels, uv);
 
-    frag_color = tex_color;
+    frag_color = vec4(tex_color.rgb * light, tex_color.a);
 }
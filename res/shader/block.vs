@@ -1,17 +1,40 @@
 #version 330 core
 
-layout (location = 0) in vec3 a_position;
-layout (location = 1) in vec2 a_tex_coords;
-layout (location = 2) in vec3 a_color;
+// Packed terrain vertex (see TerrainVertex in mesh.hpp)
+layout (location = 0) in uint a_data;
 
 out vec2 tex_coords;
+flat out vec2 tile;
+out float light;
 
+uniform vec3 chunk_origin;
 uniform mat4 model;
 uniform mat4 view;
 uniform mat4 proj;
 
+const float ATLAS_NCOLS = 16.0;
+
 void main()
 {
-    tex_coords = a_tex_coords;
-    gl_Position = proj * view * model * vec4(a_position, 1.0);
+    // Decode vertex attributes
+    vec3 position   = vec3(a_data & 31u, (a_data >> 5) & 31u, (a_data >> 10) & 31u);
+    uint face       = (a_data >> 15) & 7u;
+    uint tile_index = (a_data >> 20) & 255u;
+    light           = float((a_data >> 28) & 15u) / 15.0;
+
+    // Project the position onto the face's plane so that the texture repeats once per block.
+    // Face order matches the bit positions of BlockFace: right, left, back, front, bottom, top.
+    switch (face)
+    {
+        case 0u: tex_coords = vec2( position.x, -position.z); break;
+        case 1u: tex_coords = vec2(-position.x, -position.z); break;
+        case 2u: tex_coords = vec2(-position.y, -position.z); break;
+        case 3u: tex_coords = vec2( position.y, -position.z); break;
+        default: tex_coords = vec2( position.y, -position.x); break;
+    }
+
+    tile = vec2(float(tile_index % 16u), float(tile_index / 16u)) / ATLAS_NCOLS;
+
+    // Blocks are centered on integer world coordinates, so their corners are offset by half a block
+    gl_Position = proj * view * model * vec4(chunk_origin + position - 0.5, 1.0);
 }
@@ -0,0 +1,25 @@
+#version 330 core
+
+in vec2 tex_coords;
+flat in vec2 tile;
+in float light;
+out vec4 frag_color;
+
+uniform sampler2D texels;
+
+const float TILE_SIZE = 1.0 / 16.0;
+const float UV_PAD = 0.005;
+
+// Used for faces with fully transparent texels (e.g. leaves), which are discarded
+void main()
+{
+    // Repeat the atlas tile once per block so that merged faces aren't stretched
+    vec2 uv = tile + UV_PAD + fract(tex_coords) * (TILE_SIZE - 2.0 * UV_PAD);
+    vec4 tex_color = texture(texels, uv);
+    if (tex_color.a < 0.1)
+    {
+        discard;
+    }
+
+    frag_color = vec4(tex_color.rgb * light, tex_color.a);
+}
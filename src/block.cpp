@@ -24,3 +24,22 @@ Block::Block() :
 Block::Block(const BlockType type, const uint8_t faces) :
     type(type), faces(faces)
 {}
+
+/**
+ * @brief Retrieves the render pass that the faces of blocks of type __type__ are drawn in.
+ * @since 16-10-2026
+ * @param[in] type The block type
+ * @returns The render pass
+ */
+RenderPass Block::get_render_pass(const BlockType type)
+{
+    switch (type)
+    {
+        case BlockType::LEAVES:
+            return RenderPass::ALPHA_TESTED;
+        case BlockType::WATER:
+            return RenderPass::TRANSLUCENT;
+        default:
+            return RenderPass::OPAQUE;
+    }
+}
@@ -21,6 +21,7 @@ BlockFactory::BlockFactory()
     this->uv_cache[BlockType::LEAVES]     = get_uv_coords(BlockType::LEAVES);
     this->uv_cache[BlockType::SAND]       = get_uv_coords(BlockType::SAND);
     this->uv_cache[BlockType::STONE]      = get_uv_coords(BlockType::STONE);
+    this->uv_cache[BlockType::WATER]      = get_uv_coords(BlockType::WATER);
     // TODO: Finish...
 }
 
@@ -103,6 +104,14 @@ BlockFactory::get_uv_coords(const BlockType type) const
             ty_offset = 1.0f;
             tx_offset = 1.0f;
 
+            // Top + Sides + Bottom
+            uv_top.u = uv_sides.u = uv_bottom.u = tx_offset / (float)KC::TEX_ATLAS_NCOLS;
+            uv_top.v = uv_sides.v = uv_bottom.v = ty_offset / (float)KC::TEX_ATLAS_NCOLS;
+            break;
+        case BlockType::WATER:
+            ty_offset = 1.0f;
+            tx_offset = 2.0f;
+
             // Top + Sides + Bottom
             uv_top.u = uv_sides.u = uv_bottom.u = tx_offset / (float)KC::TEX_ATLAS_NCOLS;
             uv_top.v = uv_sides.v = uv_bottom.v = ty_offset / (float)KC::TEX_ATLAS_NCOLS;
@@ -115,30 +124,39 @@ BlockFactory::get_uv_coords(const BlockType type) const
 }
 
 /**
- * @brief Creates a single block based on the given parameters.
- * @since 16-10-2024
- * @param[in] type The block type of the block being created e.g., dirt, grass, etc.
- * @param[in] faces A mask which determines which sides of the block will be rendered
- * @param[in] world_location A vec3 which determines the location of the block relative to the world origin
- * @returns A Block object which matches the requested attributes
+ * @brief Converts the UV coordinates of an atlas tile's top-left corner into the tile's index.
+ * @since 16-10-2026
+ * @param[in] uv The UV coordinates of the tile, as returned by get_uv_coords()
+ * @returns The index of the tile, counted row by row from the top-left of the atlas
  */
-Block BlockFactory::make_block(
+static unsigned uv_to_tile(const UV uv)
+{
+    const unsigned col = (unsigned)std::lroundf(uv.u * KC::TEX_ATLAS_NCOLS);
+    const unsigned row = (unsigned)std::lroundf(uv.v * KC::TEX_ATLAS_NCOLS);
+    return (row * KC::TEX_ATLAS_NCOLS) + col;
+}
+
+/**
+ * @brief Generates the vertices for a single face spanning __size__ blocks and appends them to __vertices__.
+ * The face's texture is tiled once per block by the vertex shader, so a face covering several
+ * coplanar blocks looks identical to those blocks being meshed individually.
+ * @since 16-10-2026
+ * @param[out] vertices The vertex list that the face will be appended to
+ * @param[in] type The block type which determines the texture of the face
+ * @param[in] face The direction that the face is pointing
+ * @param[in] block_location The location of the face's minimum block relative to its chunk
+ * @param[in] size The amount of blocks that the face spans along each axis (1 along the face's normal)
+ */
+void BlockFactory::make_face_mesh(
+    std::vector<TerrainVertex> &vertices,
     const BlockType type,
-    const uint8_t faces,
-    const Vec3_t world_location
+    const BlockFace face,
+    const Vec3_t block_location,
+    const Vec3_t size
 ) const
 {
-    if (faces == 0 || type == BlockType::AIR)
-    {
-        return Block();
-    }
-
-    Block block = Block(type, faces);
-
-    // UV coordinates
-    constexpr float uv_pad = 0.005f;
-    constexpr float tw = (1.0f / KC::TEX_ATLAS_NCOLS) - uv_pad;
-    constexpr float th = (1.0f / KC::TEX_ATLAS_NCOLS) - uv_pad;
+    // TODO: Implement lighting
+    constexpr unsigned light = 15;
 
     // TODO: Something breaks when invalid block type specified...
     auto uv = this->uv_cache.at(type).value_or(std::make_tuple(UV{}, UV{}, UV{}));
@@ -146,8 +164,11 @@ Block BlockFactory::make_block(
     UV uv_sides  = std::get<1>(uv);
     UV uv_bottom = std::get<2>(uv);
 
+    const unsigned tile = uv_to_tile((face == TOP) ? uv_top : (face == BOTTOM) ? uv_bottom : uv_sides);
+    const unsigned face_index = std::countr_zero((unsigned)face);
+
     /*
-     * Vertex positions
+     * Vertex positions (relative to the chunk, so block corners lie on integer coordinates)
      *
      *   4____5
      *  /|   /|
@@ -156,68 +177,96 @@ Block BlockFactory::make_block(
      * |/   |/
      * 2----3
      */
-    Vec3_t v0 = { .v = { -0.5f + world_location.x, -0.5f + world_location.y,  0.5f + world_location.z }};
-    Vec3_t v1 = { .v = { -0.5f + world_location.x,  0.5f + world_location.y,  0.5f + world_location.z }};
-    Vec3_t v2 = { .v = { -0.5f + world_location.x, -0.5f + world_location.y, -0.5f + world_location.z }};
-    Vec3_t v3 = { .v = { -0.5f + world_location.x,  0.5f + world_location.y, -0.5f + world_location.z }};
-    Vec3_t v4 = { .v = {  0.5f + world_location.x, -0.5f + world_location.y,  0.5f + world_location.z }};
-    Vec3_t v5 = { .v = {  0.5f + world_location.x,  0.5f + world_location.y,  0.5f + world_location.z }};
-    Vec3_t v6 = { .v = {  0.5f + world_location.x, -0.5f + world_location.y, -0.5f + world_location.z }};
-    Vec3_t v7 = { .v = {  0.5f + world_location.x,  0.5f + world_location.y, -0.5f + world_location.z }};
-
-    block.right_face = {
-        Vertex{ .pos = { v1.x, v1.y, v1.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v7.x, v7.y, v7.z }, .tex = { uv_sides.u + tw,     uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v3.x, v3.y, v3.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v7.x, v7.y, v7.z }, .tex = { uv_sides.u + tw,     uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v1.x, v1.y, v1.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v5.x, v5.y, v5.z }, .tex = { uv_sides.u + tw,     uv_sides.v + uv_pad }, .rgb = {}}
-    };
-
-    block.left_face = {
-        Vertex{ .pos = { v4.x, v4.y, v4.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v2.x, v2.y, v2.z }, .tex = { uv_sides.u + tw,     uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v6.x, v6.y, v6.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v2.x, v2.y, v2.z }, .tex = { uv_sides.u + tw,     uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v4.x, v4.y, v4.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v0.x, v0.y, v0.z }, .tex = { uv_sides.u + tw,     uv_sides.v + uv_pad }, .rgb = {}}
-    };
-
-    block.front_face = {
-        Vertex{ .pos = { v0.x, v0.y, v0.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v3.x, v3.y, v3.z }, .tex = { uv_sides.u + tw,     uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v2.x, v2.y, v2.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v3.x, v3.y, v3.z }, .tex = { uv_sides.u + tw,     uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v0.x, v0.y, v0.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v1.x, v1.y, v1.z }, .tex = { uv_sides.u + tw,     uv_sides.v + uv_pad }, .rgb = {}}
-    };
+    const unsigned x0 = block_location.x, x1 = x0 + size.x;
+    const unsigned y0 = block_location.y, y1 = y0 + size.y;
+    const unsigned z0 = block_location.z, z1 = z0 + size.z;
 
-    block.back_face = {
-        Vertex{ .pos = { v5.x, v5.y, v5.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v6.x, v6.y, v6.z }, .tex = { uv_sides.u + tw,     uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v7.x, v7.y, v7.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v6.x, v6.y, v6.z }, .tex = { uv_sides.u + tw,     uv_sides.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v5.x, v5.y, v5.z }, .tex = { uv_sides.u + uv_pad, uv_sides.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v4.x, v4.y, v4.z }, .tex = { uv_sides.u + tw,     uv_sides.v + uv_pad }, .rgb = {}}
+    auto vertex = [&](const unsigned x, const unsigned y, const unsigned z, const unsigned corner)
+    {
+        return make_terrain_vertex(x, y, z, face_index, corner, tile, light);
     };
 
-    block.bottom_face = {
-        Vertex{ .pos = { v2.x, v2.y, v2.z }, .tex = { uv_bottom.u + uv_pad, uv_bottom.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v3.x, v3.y, v3.z }, .tex = { uv_bottom.u + tw,     uv_bottom.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v6.x, v6.y, v6.z }, .tex = { uv_bottom.u + uv_pad, uv_bottom.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v7.x, v7.y, v7.z }, .tex = { uv_bottom.u + tw,     uv_bottom.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v6.x, v6.y, v6.z }, .tex = { uv_bottom.u + uv_pad, uv_bottom.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v3.x, v3.y, v3.z }, .tex = { uv_bottom.u + tw,     uv_bottom.v + th     }, .rgb = {}}
-    };
+    switch (face)
+    {
+        case BOTTOM:
+        {
+            vertices.insert(vertices.end(), {
+                vertex(x0, y0, z0, 2), vertex(x0, y1, z0, 3), vertex(x1, y0, z0, 0),
+                vertex(x1, y1, z0, 1), vertex(x1, y0, z0, 0), vertex(x0, y1, z0, 3)
+            });
+            break;
+        }
+        case TOP:
+        {
+            vertices.insert(vertices.end(), {
+                vertex(x1, y0, z1, 0), vertex(x0, y1, z1, 3), vertex(x0, y0, z1, 2),
+                vertex(x0, y1, z1, 3), vertex(x1, y0, z1, 0), vertex(x1, y1, z1, 1)
+            });
+            break;
+        }
+        case RIGHT:
+        {
+            vertices.insert(vertices.end(), {
+                vertex(x0, y1, z1, 0), vertex(x1, y1, z0, 3), vertex(x0, y1, z0, 2),
+                vertex(x1, y1, z0, 3), vertex(x0, y1, z1, 0), vertex(x1, y1, z1, 1)
+            });
+            break;
+        }
+        case LEFT:
+        {
+            vertices.insert(vertices.end(), {
+                vertex(x1, y0, z1, 0), vertex(x0, y0, z0, 3), vertex(x1, y0, z0, 2),
+                vertex(x0, y0, z0, 3), vertex(x1, y0, z1, 0), vertex(x0, y0, z1, 1)
+            });
+            break;
+        }
+        case FRONT:
+        {
+            vertices.insert(vertices.end(), {
+                vertex(x0, y0, z1, 0), vertex(x0, y1, z0, 3), vertex(x0, y0, z0, 2),
+                vertex(x0, y1, z0, 3), vertex(x0, y0, z1, 0), vertex(x0, y1, z1, 1)
+            });
+            break;
+        }
+        case BACK:
+        {
+            vertices.insert(vertices.end(), {
+                vertex(x1, y1, z1, 0), vertex(x1, y0, z0, 3), vertex(x1, y1, z0, 2),
+                vertex(x1, y0, z0, 3), vertex(x1, y1, z1, 0), vertex(x1, y0, z1, 1)
+            });
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
 
-    block.top_face = {
-        Vertex{ .pos = { v4.x, v4.y, v4.z }, .tex = { uv_top.u + uv_pad, uv_top.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v1.x, v1.y, v1.z }, .tex = { uv_top.u + tw,     uv_top.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v0.x, v0.y, v0.z }, .tex = { uv_top.u + uv_pad, uv_top.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v1.x, v1.y, v1.z }, .tex = { uv_top.u + tw,     uv_top.v + th     }, .rgb = {}},
-        Vertex{ .pos = { v4.x, v4.y, v4.z }, .tex = { uv_top.u + uv_pad, uv_top.v + uv_pad }, .rgb = {}},
-        Vertex{ .pos = { v5.x, v5.y, v5.z }, .tex = { uv_top.u + tw,     uv_top.v + uv_pad }, .rgb = {}}
-    };
+/**
+ * @brief Generates the vertices for each visible face of __block__ and appends them to __vertices__.
+ * @since 16-10-2024
+ * @param[out] vertices The vertex list that the block's faces will be appended to
+ * @param[in] block The block being meshed. Only the faces set in its mask are generated
+ * @param[in] block_location A vec3 which determines the location of the block relative to its chunk
+ */
+void BlockFactory::make_block_mesh(
+    std::vector<TerrainVertex> &vertices,
+    const Block block,
+    const Vec3_t block_location
+) const
+{
+    if (block.faces == 0 || block.type == BlockType::AIR)
+    {
+        return;
+    }
 
-    return block;
+    constexpr Vec3_t size = { .v = { 1.0f, 1.0f, 1.0f }};
+    for (const BlockFace face : { BOTTOM, TOP, RIGHT, LEFT, FRONT, BACK })
+    {
+        if (IS_BIT_SET(block.faces, face))
+        {
+            make_face_mesh(vertices, block.type, face, block_location, size);
+        }
+    }
 }
@@ -0,0 +1,156 @@
+/**
+ * @file block_storage.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief Palette-compressed storage for the blocks of a single chunk.
+ * Each distinct block is stored once in a small palette, and every cell holds a bit-packed index into it.
+ * Storage that only ever contains a single kind of block keeps that block by value and allocates nothing.
+ */
+
+#include "block_storage.hpp"
+
+/**
+ * @brief Default constructor for BlockStorage class. Every block is initialized to air.
+ * @since 16-10-2026
+ */
+BlockStorage::BlockStorage() :
+    uniform(Block()),
+    bits_per_index(0),
+    palette{},
+    indices{}
+{}
+
+/**
+ * @brief Parameterized constructor for BlockStorage class. Every block is initialized to __block__.
+ * @since 16-10-2026
+ * @param[in] block The block that every cell will initially contain
+ */
+BlockStorage::BlockStorage(const Block block) :
+    uniform(block),
+    bits_per_index(0),
+    palette{},
+    indices{}
+{}
+
+/**
+ * @brief Retrieves the block stored at __index__.
+ * @since 16-10-2026
+ * @param[in] index The index of the block, in the range [0, KC::CHUNK_VOLUME)
+ * @returns A copy of the block stored at __index__
+ */
+Block BlockStorage::get(const size_t index) const
+{
+    if (this->bits_per_index == 0)
+    {
+        return this->uniform;
+    }
+
+    const size_t bit = index * this->bits_per_index;
+    const uint64_t mask = (1ULL << this->bits_per_index) - 1;
+    return this->palette[(this->indices[bit / 64] >> (bit % 64)) & mask];
+}
+
+/**
+ * @brief Stores __block__ at __index__.
+ * Uniform storage is transparently promoted to a palette the first time a differing block is written.
+ * @since 16-10-2026
+ * @param[in] index The index of the block, in the range [0, KC::CHUNK_VOLUME)
+ * @param[in] block The block to be stored
+ */
+void BlockStorage::set(const size_t index, const Block block)
+{
+    if (this->bits_per_index == 0)
+    {
+        if (block == this->uniform)
+        {
+            return;
+        }
+
+        // Promote to palette storage
+        this->palette = { this->uniform };
+        repack(1);
+    }
+
+    const size_t palette_index = get_palette_index(block);
+    const size_t bit = index * this->bits_per_index;
+    const uint64_t mask = (1ULL << this->bits_per_index) - 1;
+
+    uint64_t &word = this->indices[bit / 64];
+    word &= ~(mask << (bit % 64));
+    word |= (uint64_t)palette_index << (bit % 64);
+}
+
+/**
+ * @brief Sets every block to __block__ and releases the palette.
+ * @since 16-10-2026
+ * @param[in] block The block that every cell will contain
+ */
+void BlockStorage::fill(const Block block)
+{
+    this->uniform = block;
+    this->bits_per_index = 0;
+    this->palette = {};
+    this->indices = {};
+}
+
+/**
+ * @brief Checks whether every block within the storage is identical.
+ * @since 16-10-2026
+ * @returns True if the storage holds a single block value without a palette, otherwise returns false
+ */
+bool BlockStorage::is_uniform() const
+{
+    return this->bits_per_index == 0;
+}
+
+/**
+ * @brief Retrieves the palette index of __block__, adding it to the palette if necessary.
+ * Indices are widened whenever the palette outgrows the current index width.
+ * @since 16-10-2026
+ * @param[in] block The block being searched for
+ * @returns The index of __block__ within the palette
+ */
+size_t BlockStorage::get_palette_index(const Block block)
+{
+    auto needle = std::find(this->palette.begin(), this->palette.end(), block);
+    if (needle != this->palette.end())
+    {
+        return needle - this->palette.begin();
+    }
+
+    this->palette.push_back(block);
+    if (this->palette.size() > (1ULL << this->bits_per_index))
+    {
+        // Widths are kept to powers of two so that an index never straddles two words
+        repack(this->bits_per_index * 2);
+    }
+
+    return this->palette.size() - 1;
+}
+
+/**
+ * @brief Re-encodes every index using __bits__ bits per index.
+ * @since 16-10-2026
+ * @param[in] bits The new index width (must be a power of two no greater than 64)
+ */
+void BlockStorage::repack(const uint8_t bits)
+{
+    const size_t n_words = ((KC::CHUNK_VOLUME * bits) + 63) / 64;
+    auto repacked = std::vector<uint64_t>(n_words, 0);
+
+    if (this->bits_per_index > 0)
+    {
+        const uint64_t old_mask = (1ULL << this->bits_per_index) - 1;
+        for (size_t i = 0; i < KC::CHUNK_VOLUME; ++i)
+        {
+            const size_t old_bit = i * this->bits_per_index;
+            const size_t new_bit = i * bits;
+            const uint64_t palette_index = (this->indices[old_bit / 64] >> (old_bit % 64)) & old_mask;
+            repacked[new_bit / 64] |= palette_index << (new_bit % 64);
+        }
+    }
+
+    this->indices = std::move(repacked);
+    this->bits_per_index = bits;
+}
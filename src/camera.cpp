@@ -90,8 +90,68 @@ bool Camera::is_chunk_in_visible_radius(const Vec3_t chunk_location) const
     return c < settings.render_distance;
 }
 
-
-std::optional<Block> Camera::cast_ray(const uint8_t n_iters) const
+/**
+ * @brief Finds the first block along the camera's look direction, stepping from cell to cell (Amanatides-Woo).
+ * Air and translucent blocks (e.g. water) are passed through.
+ * @since 16-10-2026
+ * @param[in] max_distance The furthest distance from the camera at which a block may be hit
+ * @returns The block that was hit, or std::nullopt if there isn't one within reach
+ */
+std::optional<RayHit> Camera::cast_ray(const float max_distance) const
 {
+    ChunkManager &chunk_mgr = ChunkManager::get_instance();
+
+    // Blocks are centered on integer coordinates, so the cell of block i spans [i - 0.5, i + 0.5)
+    int cell[3];
+    int step[3];
+    float t_max[3];
+    float t_delta[3];
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const float origin = this->v_eye.v[axis] + 0.5f;
+        const float direction = this->v_look_dir.v[axis];
+
+        cell[axis] = (int)std::floor(origin);
+        step[axis] = (direction > 0.0f) ? 1 : -1;
+
+        // The distance along the ray between boundaries of this axis, and to the first of them
+        if (direction == 0.0f)
+        {
+            t_delta[axis] = std::numeric_limits<float>::infinity();
+            t_max[axis] = std::numeric_limits<float>::infinity();
+            continue;
+        }
+        t_delta[axis] = std::abs(1.0f / direction);
+        t_max[axis] = (direction > 0.0f)
+            ? ((cell[axis] + 1) - origin) * t_delta[axis]
+            : (origin - cell[axis]) * t_delta[axis];
+    }
+
+    int previous[3] = { cell[0], cell[1], cell[2] };
+    float t = 0.0f;
+    while (t <= max_distance)
+    {
+        const Vec3_t location = { .v = { (float)cell[0], (float)cell[1], (float)cell[2] }};
+        const auto block = chunk_mgr.get_block(location);
+        if (block.has_value() &&
+            block->type != BlockType::AIR &&
+            Block::get_render_pass(block->type) != RenderPass::TRANSLUCENT)
+        {
+            return RayHit{
+                .block_location = location,
+                .adjacent_location = { .v = { (float)previous[0], (float)previous[1], (float)previous[2] }}
+            };
+        }
+
+        // Step into the next cell along whichever axis' boundary is crossed first
+        const size_t axis = (t_max[0] < t_max[1])
+            ? ((t_max[0] < t_max[2]) ? 0 : 2)
+            : ((t_max[1] < t_max[2]) ? 1 : 2);
+        std::copy(std::begin(cell), std::end(cell), std::begin(previous));
+        cell[axis] += step[axis];
+        t = t_max[axis];
+        t_max[axis] += t_delta[axis];
+    }
+
     return std::nullopt;
 }
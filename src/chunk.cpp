@@ -8,42 +8,53 @@
 
 #include "chunk.hpp"
 
+// The face of a block which points towards each of Chunk::neighbors
+static constexpr auto neighbor_faces = std::array<BlockFace, 6>{ FRONT, BACK, LEFT, RIGHT, BOTTOM, TOP };
+
 Chunk::Chunk() :
     location{},
     update_pending(false),
-    tree_ref(),
-    vertices{}
+    is_edited(false),
+    mesh_range(std::nullopt),
+    vertices{},
+    blocks(),
+    neighbors{},
+    slice_offsets{},
+    dirty_layers{},
+    opaque_rows_x{},
+    opaque_rows_y{},
+    face_connectivity{},
+    solid_heights{}
 {
+    this->face_connectivity.fill((1 << KC::CUBE_FACES) - 1);
+
     this->block_heights.resize(
         KC::CHUNK_SIZE + 2,
         std::vector<uint8_t>(KC::CHUNK_SIZE + 2)
     );
-    this->blocks.resize(
-        KC::CHUNK_SIZE,
-        std::vector<std::vector<Block>>(
-            KC::CHUNK_SIZE,
-            std::vector<Block>(KC::CHUNK_SIZE, Block())
-        )
-    );
 }
 
 Chunk::Chunk(const Vec3_t location) :
     location(location),
     update_pending(false),
-    tree_ref(),
-    vertices{}
+    is_edited(false),
+    mesh_range(std::nullopt),
+    vertices{},
+    blocks(),
+    neighbors{},
+    slice_offsets{},
+    dirty_layers{},
+    opaque_rows_x{},
+    opaque_rows_y{},
+    face_connectivity{},
+    solid_heights{}
 {
+    this->face_connectivity.fill((1 << KC::CUBE_FACES) - 1);
+
     this->block_heights.resize(
         KC::CHUNK_SIZE + 2,
         std::vector<uint8_t>(KC::CHUNK_SIZE + 2)
     );
-    this->blocks.resize(
-        KC::CHUNK_SIZE,
-        std::vector<std::vector<Block>>(
-            KC::CHUNK_SIZE,
-            std::vector<Block>(KC::CHUNK_SIZE, Block())
-        )
-    );
 }
 
 /**
@@ -61,75 +72,874 @@ bool Chunk::operator==(const Chunk &chunk) const
 }
 
 /**
- * @brief Squashes the block vertices into one unified mesh.
+ * @brief Converts chunk-relative block coordinates into an index within Chunk::blocks.
+ * Blocks are laid out x-fastest so that each row along the x axis is contiguous in memory.
+ * @since 16-10-2026
+ * @param[in] x The x coordinate of the block, relative to the chunk
+ * @param[in] y The y coordinate of the block, relative to the chunk
+ * @param[in] z The z coordinate of the block, relative to the chunk
+ * @returns The index of the block within Chunk::blocks
+ */
+size_t Chunk::index(const size_t x, const size_t y, const size_t z)
+{
+    return (((z * KC::CHUNK_SIZE) + y) * KC::CHUNK_SIZE) + x;
+}
+
+/**
+ * @brief Converts a slice of the mesh into its index within Chunk::slice_offsets.
+ * Slices are laid out by render pass, then by direction, and then by layer, so that each pass's faces are
+ * contiguous within the mesh and can be drawn on their own.
+ * @since 16-10-2026
+ * @param[in] pass The render pass of the slice's faces
+ * @param[in] direction The direction of the slice's faces, indexed like Chunk::neighbors
+ * @param[in] layer The layer of the slice along the direction's axis
+ * @returns The index of the slice within Chunk::slice_offsets
+ */
+size_t Chunk::get_slice_index(const RenderPass pass, const size_t direction, const size_t layer)
+{
+    return ((((size_t)pass * KC::CUBE_FACES) + direction) * KC::CHUNK_SIZE) + layer;
+}
+
+/**
+ * @brief Retrieves the block at the specified location relative to the chunk.
+ * @since 16-10-2026
+ * @param[in] x The x coordinate of the block, relative to the chunk
+ * @param[in] y The y coordinate of the block, relative to the chunk
+ * @param[in] z The z coordinate of the block, relative to the chunk
+ * @returns A copy of the block at the requested location
+ */
+Block Chunk::get_block(const size_t x, const size_t y, const size_t z) const
+{
+    return this->blocks.get(index(x, y, z));
+}
+
+/**
+ * @brief Finds the chunk containing the block at the specified location relative to this chunk.
+ * Neighboring chunks are reached by following Chunk::neighbors rather than by a lookup in the GCL.
+ * @since 16-10-2026
+ * @param[in/out] x The x coordinate of the block, relative to this chunk. Relative to the found chunk afterwards
+ * @param[in/out] y The y coordinate of the block, relative to this chunk. Relative to the found chunk afterwards
+ * @param[in/out] z The z coordinate of the block, relative to this chunk. Relative to the found chunk afterwards
+ * @returns The chunk containing the block, or nullptr if it isn't loaded
+ */
+Chunk *Chunk::find_relative(int &x, int &y, int &z)
+{
+    constexpr int N = KC::CHUNK_SIZE;
+
+    Chunk *chunk = this;
+    int *pos[3] = { &x, &y, &z };
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        while (chunk != nullptr && *pos[axis] < 0)
+        {
+            chunk = chunk->neighbors[get_neighbor_index(axis, false)];
+            *pos[axis] += N;
+        }
+        while (chunk != nullptr && *pos[axis] >= N)
+        {
+            chunk = chunk->neighbors[get_neighbor_index(axis, true)];
+            *pos[axis] -= N;
+        }
+    }
+
+    return chunk;
+}
+
+/**
+ * @brief Retrieves the block at the specified location relative to the chunk, which may lie within
+ * another chunk. See Chunk::find_relative().
+ * @since 16-10-2026
+ * @param[in] x The x coordinate of the block, relative to the chunk
+ * @param[in] y The y coordinate of the block, relative to the chunk
+ * @param[in] z The z coordinate of the block, relative to the chunk
+ * @returns A copy of the block at the requested location, or std::nullopt if its chunk isn't loaded
+ */
+std::optional<Block> Chunk::get_block_relative(const int x, const int y, const int z) const
+{
+    int _x = x, _y = y, _z = z;
+    const Chunk *chunk = const_cast<Chunk*>(this)->find_relative(_x, _y, _z);
+    if (chunk == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    return chunk->get_block(_x, _y, _z);
+}
+
+/**
+ * @brief Converts the direction of a face neighbor into its index within Chunk::neighbors.
+ * The index of the neighbor in the opposite direction is always (index ^ 1).
+ * @since 16-10-2026
+ * @param[in] axis The axis (0 = x, 1 = y, 2 = z) along which the neighbor lies
+ * @param[in] is_positive True if the neighbor lies in the positive direction of __axis__
+ * @returns The index of the neighbor
+ */
+size_t Chunk::get_neighbor_index(const size_t axis, const bool is_positive)
+{
+    return (axis * 2) + (is_positive ? 1 : 0);
+}
+
+/**
+ * @brief Retrieves the face of a block which points towards the neighbor at __neighbor_index__.
+ * @since 16-10-2026
+ * @param[in] neighbor_index The neighbor's index within Chunk::neighbors
+ * @returns The face
+ */
+BlockFace Chunk::get_neighbor_face(const size_t neighbor_index)
+{
+    return neighbor_faces[neighbor_index];
+}
+
+/**
+ * @brief Replaces the block at the specified location relative to the chunk.
+ * The slices of the mesh that the block contributes to are marked as dirty, see Chunk::mark_dirty().
+ * @note The chunk's mesh is not regenerated. Call update_dirty_slices() once all edits are complete.
+ * @since 16-10-2026
+ * @param[in] x The x coordinate of the block, relative to the chunk
+ * @param[in] y The y coordinate of the block, relative to the chunk
+ * @param[in] z The z coordinate of the block, relative to the chunk
+ * @param[in] block The block to be stored at the requested location
+ */
+void Chunk::set_block(const size_t x, const size_t y, const size_t z, const Block block)
+{
+    constexpr size_t N = KC::CHUNK_SIZE;
+
+    this->blocks.set(index(x, y, z), block);
+
+    if (is_occluder(block.type))
+    {
+        SET_BIT(this->opaque_rows_x[(z * N) + y], (uint16_t)(1 << x));
+        SET_BIT(this->opaque_rows_y[(z * N) + x], (uint16_t)(1 << y));
+    }
+    else
+    {
+        UNSET_BIT(this->opaque_rows_x[(z * N) + y], (uint16_t)(1 << x));
+        UNSET_BIT(this->opaque_rows_y[(z * N) + x], (uint16_t)(1 << y));
+    }
+
+    mark_dirty(x, y, z);
+}
+
+/**
+ * @brief Replaces every block of the chunk with __block__, and marks the chunk's entire mesh as dirty.
+ * @since 16-10-2026
+ * @param[in] block The block to be stored throughout the chunk
+ */
+void Chunk::fill(const Block block)
+{
+    this->blocks.fill(block);
+    this->opaque_rows_x.fill(is_occluder(block.type) ? UINT16_MAX : 0);
+    this->opaque_rows_y.fill(is_occluder(block.type) ? UINT16_MAX : 0);
+    this->dirty_layers.fill(UINT16_MAX);
+}
+
+/**
+ * @brief Marks every slice of the mesh that a change to the block at the specified location may affect.
+ * Within each direction, these are the block's own layer and the layer of the block facing it, which
+ * lies within a neighboring chunk if the block is on the border.
+ * @since 16-10-2026
+ * @param[in] x The x coordinate of the block, relative to the chunk
+ * @param[in] y The y coordinate of the block, relative to the chunk
+ * @param[in] z The z coordinate of the block, relative to the chunk
+ */
+void Chunk::mark_dirty(const size_t x, const size_t y, const size_t z)
+{
+    constexpr int N = KC::CHUNK_SIZE;
+    const int pos[3] = { (int)x, (int)y, (int)z };
+
+    for (size_t direction = 0; direction < KC::CUBE_FACES; ++direction)
+    {
+        const size_t axis = direction / 2;
+        const bool is_positive = direction & 1;
+        SET_BIT(this->dirty_layers[direction], 1 << pos[axis]);
+
+        // The block whose face in this direction points at the changed block
+        const int facing = pos[axis] + (is_positive ? -1 : 1);
+        if (facing >= 0 && facing < N)
+        {
+            SET_BIT(this->dirty_layers[direction], 1 << facing);
+        }
+        else
+        {
+            Chunk *neighbor = this->neighbors[get_neighbor_index(axis, !is_positive)];
+            if (neighbor != nullptr)
+            {
+                SET_BIT(neighbor->dirty_layers[direction], 1 << (is_positive ? N - 1 : 0));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Marks a single slice of the mesh as dirty.
+ * @since 16-10-2026
+ * @param[in] direction The direction of the slice's faces, indexed like Chunk::neighbors
+ * @param[in] layer The layer of the slice along the direction's axis
+ */
+void Chunk::mark_slice_dirty(const size_t direction, const size_t layer)
+{
+    SET_BIT(this->dirty_layers[direction], 1 << layer);
+}
+
+/**
+ * @brief Checks whether any slice of the chunk's mesh needs to be regenerated.
+ * @since 16-10-2026
+ * @returns True if the chunk has dirty slices, otherwise returns false
+ */
+bool Chunk::is_dirty() const
+{
+    return std::any_of(this->dirty_layers.begin(), this->dirty_layers.end(), [](const uint16_t layers)
+    {
+        return layers != 0;
+    });
+}
+
+/**
+ * @brief Regenerates the chunk's entire mesh.
  * @since 13-02-2025
+ * @param[in] is_greedy Whether coplanar faces should be merged, see Chunk::make_slice_mesh()
+ */
+void Chunk::update_mesh(const bool is_greedy)
+{
+    this->dirty_layers.fill(UINT16_MAX);
+    update_dirty_slices(is_greedy);
+}
+
+/**
+ * @brief Regenerates the slices of the chunk's mesh that have been marked as dirty, reusing the vertices
+ * of every other slice. The mesh is kept as one slice per face direction and layer, so an edit to a single
+ * block only remeshes the few slices it touches. The mode is passed in rather than read from the settings,
+ * since chunks are meshed on worker threads while the settings may be changed on the main thread.
+ * @since 16-10-2026
+ * @param[in] is_greedy Whether coplanar faces should be merged, see Chunk::make_slice_mesh()
  */
-void Chunk::update_mesh()
+void Chunk::update_dirty_slices(const bool is_greedy)
 {
+    constexpr size_t N = KC::CHUNK_SIZE;
+
+    if (!is_dirty())
+    {
+        return;
+    }
+
+    const auto dirty_layers = this->dirty_layers;
+    this->dirty_layers.fill(0);
     this->update_pending = true;
-    this->vertices.clear();
 
-    for (size_t z = 0; z < KC::CHUNK_SIZE; ++z)
+    update_face_connectivity();
+    update_solid_heights();
+
+    // Chunks made up of a single kind of block only have visible faces if that block does
+    if (this->blocks.is_uniform())
+    {
+        const Block block = this->blocks.get(0);
+        if (block.type == BlockType::AIR || block.faces == 0)
+        {
+            this->vertices.clear();
+            this->slice_offsets.fill(0);
+            return;
+        }
+    }
+
+    // Decode the palette once up front rather than once per slice. Alongside it, gather the blocks whose
+    // face in each direction is enabled as rows of bits laid out like the slices, separately for each render
+    // pass, see Chunk::make_slice_mesh()
+    using FaceRows = std::array<std::array<uint16_t, N * N>, KC::CUBE_FACES>;
+    auto cells = std::array<Block, KC::CHUNK_VOLUME>{};
+    auto face_rows = std::array<FaceRows, KC::RENDER_PASSES>{};
+    for (size_t z = 0; z < N; ++z)
     {
-        for (size_t y = 0; y < KC::CHUNK_SIZE; ++y)
+        for (size_t y = 0; y < N; ++y)
         {
-            for (size_t x = 0; x < KC::CHUNK_SIZE; ++x)
+            for (size_t x = 0; x < N; ++x)
             {
-                Block &block = blocks[z][y][x];
-                if (block.type == BlockType::AIR || block.faces == 0)
+                const size_t i = index(x, y, z);
+                cells[i] = this->blocks.get(i);
+
+                const uint8_t faces = (cells[i].type == BlockType::AIR) ? 0 : cells[i].faces;
+                if (faces == 0)
                 {
                     continue;
                 }
 
-                if (IS_BIT_SET(block.faces, BlockFace::BOTTOM))
+                // Row (layer, b) of each direction's slices, and the block's bit along a within it
+                FaceRows &rows = face_rows[(size_t)Block::get_render_pass(cells[i].type)];
+                for (size_t direction = 0; direction < 2; ++direction)
                 {
-                    this->vertices.insert(
-                        this->vertices.end(),
-                        block.bottom_face.begin(),
-                        block.bottom_face.end()
-                    );
+                    const auto is_set = (uint16_t)((faces & neighbor_faces[direction]) != 0);
+                    rows[direction][(x * N) + z] |= (uint16_t)(is_set << y);
                 }
-                if (IS_BIT_SET(block.faces, BlockFace::TOP))
+                for (size_t direction = 2; direction < 4; ++direction)
                 {
-                    this->vertices.insert(
-                        this->vertices.end(),
-                        block.top_face.begin(),
-                        block.top_face.end()
-                    );
+                    const auto is_set = (uint16_t)((faces & neighbor_faces[direction]) != 0);
+                    rows[direction][(y * N) + z] |= (uint16_t)(is_set << x);
                 }
-                if (IS_BIT_SET(block.faces, BlockFace::RIGHT))
+                for (size_t direction = 4; direction < 6; ++direction)
                 {
-                    this->vertices.insert(
-                        this->vertices.end(),
-                        block.right_face.begin(),
-                        block.right_face.end()
-                    );
+                    const auto is_set = (uint16_t)((faces & neighbor_faces[direction]) != 0);
+                    rows[direction][(z * N) + y] |= (uint16_t)(is_set << x);
                 }
-                if (IS_BIT_SET(block.faces, BlockFace::LEFT))
+            }
+        }
+    }
+
+    auto new_vertices = std::vector<TerrainVertex>{};
+    auto new_offsets = decltype(this->slice_offsets){};
+    new_vertices.reserve(this->vertices.size());
+
+    for (size_t pass = 0; pass < KC::RENDER_PASSES; ++pass)
+    {
+        for (size_t direction = 0; direction < KC::CUBE_FACES; ++direction)
+        {
+            for (size_t layer = 0; layer < N; ++layer)
+            {
+                const size_t slice = get_slice_index((RenderPass)pass, direction, layer);
+                new_offsets[slice] = new_vertices.size();
+
+                if (IS_BIT_SET(dirty_layers[direction], 1 << layer))
                 {
-                    this->vertices.insert(
-                        this->vertices.end(),
-                        block.left_face.begin(),
-                        block.left_face.end()
+                    make_slice_mesh(
+                        new_vertices,
+                        cells,
+                        face_rows[pass][direction],
+                        (RenderPass)pass,
+                        direction,
+                        layer,
+                        is_greedy
                     );
                 }
-                if (IS_BIT_SET(block.faces, BlockFace::FRONT))
+                else
                 {
-                    this->vertices.insert(
-                        this->vertices.end(),
-                        block.front_face.begin(),
-                        block.front_face.end()
+                    new_vertices.insert(
+                        new_vertices.end(),
+                        this->vertices.begin() + this->slice_offsets[slice],
+                        this->vertices.begin() + this->slice_offsets[slice + 1]
                     );
                 }
-                if (IS_BIT_SET(block.faces, BlockFace::BACK))
+            }
+        }
+    }
+    new_offsets.back() = new_vertices.size();
+
+    this->vertices.swap(new_vertices);
+    this->slice_offsets = new_offsets;
+}
+
+/**
+ * @brief Checks whether a block of type __type__ hides the faces of the blocks adjacent to it.
+ * @since 16-10-2026
+ * @param[in] type The block type
+ * @returns True if the block is opaque, otherwise returns false
+ */
+bool Chunk::is_occluder(const BlockType type)
+{
+    return type != BlockType::AIR && Block::get_render_pass(type) == RenderPass::OPAQUE;
+}
+
+/**
+ * @brief Recomputes the faces of every block within the box spanning __min__ to __max__ (inclusive),
+ * relative to the chunk. The box may extend into loaded neighboring chunks.
+ * A face is enabled if the block it points at isn't opaque. Faces pointing into a neighboring chunk are
+ * only ever enabled, since whether they are hidden is decided against the apron when meshing, and a
+ * face pointing into a chunk which isn't loaded is left as is.
+ * @since 16-10-2026
+ * @param[in] min The lowest corner of the box, relative to the chunk
+ * @param[in] max The highest corner of the box, relative to the chunk
+ */
+void Chunk::update_faces(const std::array<int, 3> &min, const std::array<int, 3> &max)
+{
+    constexpr int N = KC::CHUNK_SIZE;
+
+    for (int z = min[2]; z <= max[2]; ++z)
+    {
+        for (int y = min[1]; y <= max[1]; ++y)
+        {
+            for (int x = min[0]; x <= max[0]; ++x)
+            {
+                int pos[3] = { x, y, z };
+                Chunk *chunk = find_relative(pos[0], pos[1], pos[2]);
+                if (chunk == nullptr)
+                {
+                    continue;
+                }
+
+                Block block = chunk->get_block(pos[0], pos[1], pos[2]);
+                if (block.type == BlockType::AIR)
                 {
-                    this->vertices.insert(
-                        this->vertices.end(),
-                        block.back_face.begin(),
-                        block.back_face.end()
-                    );
+                    continue;
+                }
+
+                uint8_t faces = block.faces;
+                for (size_t direction = 0; direction < KC::CUBE_FACES; ++direction)
+                {
+                    int adjacent[3] = { pos[0], pos[1], pos[2] };
+                    adjacent[direction / 2] += (direction & 1) ? 1 : -1;
+
+                    const BlockFace face = neighbor_faces[direction];
+                    if (adjacent[direction / 2] >= 0 && adjacent[direction / 2] < N)
+                    {
+                        if (is_occluder(chunk->get_block(adjacent[0], adjacent[1], adjacent[2]).type))
+                        {
+                            UNSET_BIT(faces, face);
+                        }
+                        else
+                        {
+                            SET_BIT(faces, face);
+                        }
+                        continue;
+                    }
+
+                    const auto neighbor = chunk->get_block_relative(adjacent[0], adjacent[1], adjacent[2]);
+                    if (neighbor.has_value() && !is_occluder(neighbor->type))
+                    {
+                        SET_BIT(faces, face);
+                    }
+                }
+
+                if (faces != block.faces)
+                {
+                    block.faces = faces;
+                    chunk->set_block(pos[0], pos[1], pos[2], block);
                 }
             }
         }
     }
 }
+
+/**
+ * @brief Checks whether the chunk's mesh has any faces drawn in the render pass __pass__.
+ * @since 16-10-2026
+ * @param[in] pass The render pass
+ * @returns True if the mesh has faces within __pass__, otherwise returns false
+ */
+bool Chunk::has_faces(const RenderPass pass) const
+{
+    const size_t begin = get_slice_index(pass, 0, 0);
+    return this->slice_offsets[begin + (KC::CUBE_FACES * KC::CHUNK_SIZE)] > this->slice_offsets[begin];
+}
+
+/**
+ * @brief Collects the ranges of the chunk's uploaded mesh whose faces are drawn in the render pass __pass__
+ * and may point towards the camera. Within a pass, the mesh is ordered by direction and then by layer, with
+ * the negative direction of each axis directly followed by its positive direction (see
+ * Chunk::get_slice_index()). A layer's faces pointing towards -axis can only be seen from below the layer,
+ * and those pointing towards +axis from above it, so each axis is left with a single range running from the
+ * first visible layer of its negative direction to the last visible layer of its positive direction.
+ * Triangles within the ranges are still subject to GL_CULL_FACE.
+ * @since 16-10-2026
+ * @param[in] pass The render pass
+ * @param[in] v_eye The camera's location
+ * @param[out] firsts Appended with the index of each range's first vertex within the terrain arena
+ * @param[out] counts Appended with the amount of vertices within each range
+ */
+void Chunk::get_facing_ranges(
+    const RenderPass pass,
+    const Vec3_t v_eye,
+    std::vector<GLint> &firsts,
+    std::vector<GLsizei> &counts
+) const
+{
+    constexpr int N = KC::CHUNK_SIZE;
+
+    if (!this->mesh_range.has_value())
+    {
+        return;
+    }
+
+    uint32_t prev_end = UINT32_MAX;
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        // Blocks are centered on integer coordinates, so the faces of layer L lie at L - 0.5 and L + 0.5
+        const float eye = v_eye.v[axis] - (this->location.v[axis] * N);
+        const int first_layer = std::clamp((int)std::floor(eye + 0.5f) + 1, 0, N);
+        const int last_layer = std::clamp((int)std::ceil(eye - 0.5f), 0, N);
+
+        const uint32_t begin = this->slice_offsets[get_slice_index(pass, get_neighbor_index(axis, false), first_layer)];
+        const uint32_t end = this->slice_offsets[get_slice_index(pass, get_neighbor_index(axis, true), last_layer)];
+        if (end <= begin)
+        {
+            continue;
+        }
+
+        // Ranges of consecutive axes which touch are submitted as one
+        if (begin == prev_end)
+        {
+            counts.back() += end - begin;
+        }
+        else
+        {
+            firsts.push_back(this->mesh_range->offset + begin);
+            counts.push_back(end - begin);
+        }
+        prev_end = end;
+    }
+}
+
+/**
+ * @brief Checks whether the chunk's mesh may contain faces along the border it shares with one of its
+ * neighbors that the neighbor's blocks now hide. This is the case when the neighbor has been loaded
+ * since the chunk was meshed.
+ * @since 16-10-2026
+ * @param[in] neighbor_index The neighbor's index within Chunk::neighbors
+ * @returns True if the border's slice needs to be remeshed, otherwise returns false
+ */
+bool Chunk::has_hidden_border_faces(const size_t neighbor_index) const
+{
+    constexpr size_t N = KC::CHUNK_SIZE;
+
+    const Chunk *neighbor = this->neighbors[neighbor_index];
+    if (neighbor == nullptr)
+    {
+        return false;
+    }
+
+    // The border layer along the neighbor's axis, and the two axes that span it
+    const size_t n = neighbor_index / 2;
+    const size_t a = (n == 0) ? 1 : 0;
+    const size_t b = (n == 2) ? 1 : 2;
+    const bool is_positive = neighbor_index & 1;
+    const BlockFace face = neighbor_faces[neighbor_index];
+
+    size_t pos[3];
+    size_t neighbor_pos[3];
+    pos[n] = is_positive ? N - 1 : 0;
+    neighbor_pos[n] = is_positive ? 0 : N - 1;
+
+    for (size_t j = 0; j < N; ++j)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            pos[a] = neighbor_pos[a] = i;
+            pos[b] = neighbor_pos[b] = j;
+
+            const Block block = get_block(pos[0], pos[1], pos[2]);
+            if (block.type == BlockType::AIR || !IS_BIT_SET(block.faces, face))
+            {
+                continue;
+            }
+
+            if (is_occluder(neighbor->get_block(neighbor_pos[0], neighbor_pos[1], neighbor_pos[2]).type))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Retrieves a row of the opaque blocks within a slice, as a mask of bits along the slice's first axis.
+ * Layers just outside of the chunk are read from the neighboring chunk's masks, which serves as the apron
+ * when meshing the chunk's border slices.
+ * @since 16-10-2026
+ * @param[in] axis The axis along which the slice's faces point (0 = x, 1 = y, 2 = z)
+ * @param[in] layer The layer of the slice along __axis__, which may be -1 or CHUNK_SIZE
+ * @param[in] row The row within the slice, along its second axis
+ * @returns The mask of opaque blocks, or 0 if __layer__ lies within a neighbor that isn't loaded
+ */
+uint16_t Chunk::get_opaque_row(const size_t axis, const int layer, const int row) const
+{
+    constexpr int N = KC::CHUNK_SIZE;
+
+    if (layer < 0 || layer >= N)
+    {
+        const Chunk *neighbor = this->neighbors[get_neighbor_index(axis, layer >= N)];
+        if (neighbor == nullptr)
+        {
+            return 0;
+        }
+
+        return neighbor->get_opaque_row(axis, (layer + N) % N, row);
+    }
+
+    switch (axis)
+    {
+        case 0:
+            return this->opaque_rows_y[(row * N) + layer];
+        case 1:
+            return this->opaque_rows_x[(row * N) + layer];
+        default:
+            return this->opaque_rows_x[(layer * N) + row];
+    }
+}
+
+/**
+ * @brief Recomputes which faces of the chunk can be seen from each other, by flood filling the non-opaque
+ * blocks from every block along the chunk's border. Two faces are connected if a single region of
+ * non-opaque blocks touches both, see ChunkManager::get_draw_list().
+ * @since 16-10-2026
+ */
+void Chunk::update_face_connectivity()
+{
+    constexpr int N = KC::CHUNK_SIZE;
+    constexpr uint8_t ALL_FACES = (1 << KC::CUBE_FACES) - 1;
+
+    const bool is_open = std::all_of(this->opaque_rows_x.begin(), this->opaque_rows_x.end(), [](const uint16_t row)
+    {
+        return row == 0;
+    });
+    const bool is_solid = std::all_of(this->opaque_rows_x.begin(), this->opaque_rows_x.end(), [](const uint16_t row)
+    {
+        return row == UINT16_MAX;
+    });
+
+    if (is_open || is_solid)
+    {
+        this->face_connectivity.fill(is_open ? ALL_FACES : 0);
+        return;
+    }
+
+    this->face_connectivity.fill(0);
+
+    // Visited blocks, laid out like Chunk::opaque_rows_x. Opaque blocks count as visited
+    auto visited = this->opaque_rows_x;
+    auto stack = std::vector<uint16_t>{};
+    stack.reserve(KC::CHUNK_VOLUME);
+
+    auto flood_fill = [&](const int x, const int y, const int z)
+    {
+        if (IS_BIT_SET(visited[(z * N) + y], 1 << x))
+        {
+            return;
+        }
+
+        uint8_t faces = 0;
+        SET_BIT(visited[(z * N) + y], 1 << x);
+        stack.push_back((uint16_t)index(x, y, z));
+
+        while (!stack.empty())
+        {
+            const int i = stack.back();
+            stack.pop_back();
+
+            const int pos[3] = { i % N, (i / N) % N, i / (N * N) };
+            for (size_t direction = 0; direction < KC::CUBE_FACES; ++direction)
+            {
+                int adjacent[3] = { pos[0], pos[1], pos[2] };
+                adjacent[direction / 2] += (direction & 1) ? 1 : -1;
+
+                if (adjacent[direction / 2] < 0 || adjacent[direction / 2] >= N)
+                {
+                    SET_BIT(faces, 1 << direction);
+                    continue;
+                }
+
+                uint16_t &row = visited[(adjacent[2] * N) + adjacent[1]];
+                if (!IS_BIT_SET(row, 1 << adjacent[0]))
+                {
+                    SET_BIT(row, 1 << adjacent[0]);
+                    stack.push_back((uint16_t)index(adjacent[0], adjacent[1], adjacent[2]));
+                }
+            }
+        }
+
+        for (size_t direction = 0; direction < KC::CUBE_FACES; ++direction)
+        {
+            if (IS_BIT_SET(faces, 1 << direction))
+            {
+                SET_BIT(this->face_connectivity[direction], faces);
+            }
+        }
+    };
+
+    // Regions which don't touch the border can't connect any faces, so only the border seeds the fill
+    for (int j = 0; j < N; ++j)
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            flood_fill(0, i, j);
+            flood_fill(N - 1, i, j);
+            flood_fill(i, 0, j);
+            flood_fill(i, N - 1, j);
+            flood_fill(i, j, 0);
+            flood_fill(i, j, N - 1);
+        }
+    }
+}
+
+/**
+ * @brief Recomputes, for each 8x8 quarter of the chunk's columns, the height from the chunk's bottom up to
+ * which every block is opaque. These solid boxes are what hides terrain behind hills, see OcclusionBuffer.
+ * @since 16-10-2026
+ */
+void Chunk::update_solid_heights()
+{
+    constexpr size_t N = KC::CHUNK_SIZE;
+    constexpr size_t Q = N / 2;
+
+    for (size_t quarter = 0; quarter < this->solid_heights.size(); ++quarter)
+    {
+        const size_t x0 = (quarter & 1) * Q;
+        const size_t y0 = (quarter >> 1) * Q;
+        const auto row_mask = (uint16_t)(((1 << Q) - 1) << x0);
+
+        size_t z = 0;
+        for (bool is_solid = true; is_solid && z < N; z += is_solid)
+        {
+            for (size_t y = y0; y < y0 + Q && is_solid; ++y)
+            {
+                is_solid = IS_BIT_SET(this->opaque_rows_x[(z * N) + y], row_mask);
+            }
+        }
+
+        this->solid_heights[quarter] = z;
+    }
+}
+
+/**
+ * @brief Meshes a single slice of the chunk, i.e. the faces pointing in one direction within one layer.
+ * A face is meshed if it is enabled within the block's Block::faces, and if the block that it faces isn't
+ * opaque. Both are kept as rows of bits, so the visible faces of a whole row are found with a single
+ * AND-NOT against the opaque blocks of the layer in front of it. Blocks along the border are compared
+ * against a one block apron read from the neighboring chunks' masks, so faces between two chunks are culled
+ * just like those within one. Where a neighbor isn't loaded, the block's own faces (derived from the
+ * heightmap when the chunk was generated) are used as they are.
+ *
+ * The greedy mesher merges coplanar faces of the same block type into maximal rectangles: rows are grown
+ * as wide as possible, then extended downwards for as long as every block beneath them matches. Otherwise,
+ * one quad is emitted per face.
+ * @since 16-10-2026
+ * @param[out] vertices The vertex list that the slice's faces will be appended to
+ * @param[in] cells The decoded blocks of the chunk
+ * @param[in] face_rows The blocks of __pass__ whose face in __direction__ is enabled, one row per (layer, row)
+ * @param[in] pass The render pass of the blocks within __face_rows__
+ * @param[in] direction The direction of the slice's faces, indexed like Chunk::neighbors
+ * @param[in] layer The layer of the slice along the direction's axis
+ * @param[in] is_greedy Whether faces should be merged
+ */
+void Chunk::make_slice_mesh(
+    std::vector<TerrainVertex> &vertices,
+    const std::array<Block, KC::CHUNK_VOLUME> &cells,
+    const std::array<uint16_t, KC::CHUNK_SIZE * KC::CHUNK_SIZE> &face_rows,
+    const RenderPass pass,
+    const size_t direction,
+    const size_t layer,
+    const bool is_greedy
+) const
+{
+    BlockFactory &block_factory = BlockFactory::get_instance();
+    constexpr int N = KC::CHUNK_SIZE;
+
+    // The axis along which the faces' normal points, followed by the two axes that span the slice
+    const size_t n = direction / 2;
+    const size_t a = (n == 0) ? 1 : 0;
+    const size_t b = (n == 2) ? 1 : 2;
+    const BlockFace face = neighbor_faces[direction];
+    const int facing = (int)layer + ((direction & 1) ? 1 : -1);
+
+    // Most slices of the non-opaque passes are empty, so check for enabled faces before reading any masks
+    uint16_t is_visible = 0;
+    for (int j = 0; j < N; ++j)
+    {
+        is_visible |= face_rows[(layer * N) + j];
+    }
+
+    if (is_visible == 0)
+    {
+        return;
+    }
+
+    // Visible faces, one row of bits along a per row along b
+    auto rows = std::array<uint16_t, N>{};
+    is_visible = 0;
+    for (int j = 0; j < N; ++j)
+    {
+        rows[j] = face_rows[(layer * N) + j] & ~get_opaque_row(n, facing, j);
+        is_visible |= rows[j];
+    }
+
+    int pos[3];
+    pos[n] = layer;
+
+    // Translucent faces are hidden by blocks of their own type as well, so that e.g. a body of water is only
+    // meshed along its surface. These are rare enough to be looked up one block at a time
+    if (pass == RenderPass::TRANSLUCENT && is_visible != 0)
+    {
+        is_visible = 0;
+        for (int j = 0; j < N; ++j)
+        {
+            for (uint16_t bits = rows[j]; bits != 0; bits &= (uint16_t)(bits - 1))
+            {
+                const int i = std::countr_zero(bits);
+                pos[a] = i;
+                pos[b] = j;
+                const BlockType type = cells[index(pos[0], pos[1], pos[2])].type;
+
+                int adjacent[3] = { pos[0], pos[1], pos[2] };
+                adjacent[n] = facing;
+                const auto neighbor = get_block_relative(adjacent[0], adjacent[1], adjacent[2]);
+                if (neighbor.has_value() && neighbor->type == type)
+                {
+                    UNSET_BIT(rows[j], (uint16_t)(1 << i));
+                }
+            }
+            is_visible |= rows[j];
+        }
+    }
+
+    if (is_visible == 0)
+    {
+        return;
+    }
+
+    auto get_type = [&](const int i, const int j)
+    {
+        pos[a] = i;
+        pos[b] = j;
+        return cells[index(pos[0], pos[1], pos[2])].type;
+    };
+
+    // Consume the visible faces one rectangle at a time
+    for (int j = 0; j < N; ++j)
+    {
+        while (rows[j] != 0)
+        {
+            const int i = std::countr_zero(rows[j]);
+            const BlockType type = get_type(i, j);
+
+            int w = 1;
+            int h = 1;
+            if (is_greedy)
+            {
+                while (i + w < N && IS_BIT_SET(rows[j], 1 << (i + w)) && get_type(i + w, j) == type)
+                {
+                    ++w;
+                }
+
+                const auto run = (uint16_t)(((1u << w) - 1) << i);
+                while (j + h < N && (rows[j + h] & run) == run)
+                {
+                    bool is_match = true;
+                    for (int di = 0; di < w && is_match; ++di)
+                    {
+                        is_match = get_type(i + di, j + h) == type;
+                    }
+
+                    if (!is_match)
+                    {
+                        break;
+                    }
+                    ++h;
+                }
+            }
+
+            const auto run = (uint16_t)(((1u << w) - 1) << i);
+            for (int dj = 0; dj < h; ++dj)
+            {
+                UNSET_BIT(rows[j + dj], run);
+            }
+
+            pos[a] = i;
+            pos[b] = j;
+            Vec3_t block_location = { .v = { (float)pos[0], (float)pos[1], (float)pos[2] }};
+
+            Vec3_t size = { .v = { 1.0f, 1.0f, 1.0f }};
+            size.v[a] = w;
+            size.v[b] = h;
+
+            block_factory.make_face_mesh(vertices, type, face, block_location, size);
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/**
+ * @file chunk_bounds.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief The bounding boxes of the loaded chunks, packed as a structure of arrays.
+ * Boxes are kept densely packed by moving the last box into the slot of an erased one, so that culling
+ * passes can sweep each component of every box as one contiguous array.
+ */
+
+#include "chunk_bounds.hpp"
+
+/**
+ * @brief Retrieves the amount of bounding boxes.
+ * @since 16-10-2026
+ * @returns The amount of bounding boxes
+ */
+size_t ChunkBounds::size() const
+{
+    return this->chunks.size();
+}
+
+/**
+ * @brief Adds the bounding box of __chunk__, unless it is already present.
+ * @since 16-10-2026
+ * @param[in] chunk The chunk. Must be erased before it is destroyed
+ */
+void ChunkBounds::insert(Chunk *chunk)
+{
+    const auto [needle, is_inserted] = this->slots.try_emplace(ChunkMapKey(chunk->location), this->chunks.size());
+    if (!is_inserted)
+    {
+        return;
+    }
+
+    // Blocks are centered on integer coordinates, so the chunk's blocks extend half a block past its origin
+    const Vec3_t origin = qm_v3_add(qm_v3_scale(chunk->location, KC::CHUNK_SIZE), Vec3_t{ .v = { -0.5f, -0.5f, -0.5f }});
+    this->min_x.push_back(origin.x);
+    this->min_y.push_back(origin.y);
+    this->min_z.push_back(origin.z);
+    this->max_x.push_back(origin.x + KC::CHUNK_SIZE);
+    this->max_y.push_back(origin.y + KC::CHUNK_SIZE);
+    this->max_z.push_back(origin.z + KC::CHUNK_SIZE);
+    this->chunks.push_back(chunk);
+}
+
+/**
+ * @brief Removes the bounding box of the chunk located at __chunk_key__ (if any).
+ * @since 16-10-2026
+ * @param[in] chunk_key The location of the chunk
+ */
+void ChunkBounds::erase(const ChunkMapKey &chunk_key)
+{
+    auto needle = this->slots.find(chunk_key);
+    if (needle == this->slots.end())
+    {
+        return;
+    }
+
+    const size_t slot = needle->second;
+    const size_t last = this->chunks.size() - 1;
+    this->slots.erase(needle);
+
+    // Fill the hole with the last box, so that the arrays remain dense
+    if (slot != last)
+    {
+        this->min_x[slot] = this->min_x[last];
+        this->min_y[slot] = this->min_y[last];
+        this->min_z[slot] = this->min_z[last];
+        this->max_x[slot] = this->max_x[last];
+        this->max_y[slot] = this->max_y[last];
+        this->max_z[slot] = this->max_z[last];
+        this->chunks[slot] = this->chunks[last];
+        this->slots[ChunkMapKey(this->chunks[slot]->location)] = slot;
+    }
+
+    this->min_x.pop_back();
+    this->min_y.pop_back();
+    this->min_z.pop_back();
+    this->max_x.pop_back();
+    this->max_y.pop_back();
+    this->max_z.pop_back();
+    this->chunks.pop_back();
+}
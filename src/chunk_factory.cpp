@@ -23,7 +23,6 @@ ChunkFactory &ChunkFactory::get_instance()
  */
 std::shared_ptr<Chunk> ChunkFactory::make_chunk(const Vec3_t chunk_location) const
 {
-    BlockFactory &block_factory = BlockFactory::get_instance();
     auto chunk = std::make_shared<Chunk>(chunk_location);
 
     struct
@@ -32,18 +31,26 @@ std::shared_ptr<Chunk> ChunkFactory::make_chunk(const Vec3_t chunk_location) con
         uint8_t faces = 0;
     } block_data;
 
-    // Calculate block heights
-    for (ssize_t y = -1; y < KC::CHUNK_SIZE + 1; ++y)
+    // Retrieve block heights (including a one block border shared with neighboring chunks)
+    HeightmapCache::get_instance().get_bordered(
+        ChunkColumn{ .x = (int)chunk_location.x, .y = (int)chunk_location.y },
+        chunk->block_heights
+    );
+
+    // Chunks that lie entirely above the terrain are left as uniform air, and chunks that lie
+    // entirely beneath it are filled with a single faceless block, neither of which needs a palette
+    const auto [lo, hi] = std::ranges::minmax(chunk->block_heights | std::views::join);
+    const size_t chunk_z_min = chunk_location.z * KC::CHUNK_SIZE;
+    const size_t chunk_z_max = chunk_z_min + KC::CHUNK_SIZE - 1;
+
+    if (chunk_z_min > hi)
     {
-        for (ssize_t x = -1; x < KC::CHUNK_SIZE + 1; ++x)
-        {
-            chunk->block_heights[y + 1][x + 1] = sample_biome_height(
-                Vec2_t{ .v = {
-                    (chunk_location.x * KC::CHUNK_SIZE) + x,
-                    (chunk_location.y * KC::CHUNK_SIZE) + y
-                }}
-            );
-        }
+        return chunk;
+    }
+    if (chunk_z_min > 0 && chunk_z_max < lo)
+    {
+        chunk->fill(Block(BlockType::GRASS, 0));
+        return chunk;
     }
 
     // Determine block types and visible faces
@@ -95,18 +102,8 @@ std::shared_ptr<Chunk> ChunkFactory::make_chunk(const Vec3_t chunk_location) con
                     block_data.faces |= RIGHT;
                 }
 
-                Vec3_t world_location = { .v = {
-                     (chunk_location.x * KC::CHUNK_SIZE) + x,
-                     (chunk_location.y * KC::CHUNK_SIZE) + y,
-                     (chunk_location.z * KC::CHUNK_SIZE) + z
-                }};
-
                 // Construct block
-                chunk->blocks[z][y][x] = block_factory.make_block(
-                    block_data.type,
-                    block_data.faces,
-                    world_location
-                );
+                chunk->set_block(x, y, z, Block(block_data.type, block_data.faces));
             }
         }
     }
@@ -10,51 +10,103 @@
 
 #include "chunk_manager.hpp"
 
-ChunkManager::ChunkManager()
-{
-    glGenVertexArrays(1, &this->terrain_mesh.vao);
-    glBindVertexArray(this->terrain_mesh.vao);
+ChunkManager::ChunkManager() :
+    terrain_arena(KC::TERRAIN_ARENA_CAPACITY),
+    structures(StructureTemplate::load_all("res/structures")),
+    workers(Settings::get_instance().worker_threads)
+{}
 
-    glGenBuffers(1, &this->terrain_mesh.vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, this->terrain_mesh.vbo);
+ChunkManager::~ChunkManager()
+{}
 
-    // Position attribute
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
+/**
+ * @brief Entry point for accessing the singleton's instance.
+ * @since 13-02-2025
+ * @returns A reference to the single ChunkManager instance;
+ */
+ChunkManager &ChunkManager::get_instance()
+{
+    static ChunkManager chunk_mgr;
+    return chunk_mgr;
+}
 
-    // Texture attribute
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+/**
+ * @brief Retrieves the block at __world_location__.
+ * @since 16-10-2026
+ * @param[in] world_location The location of the block, in world coordinates
+ * @returns A copy of the block, or std::nullopt if its chunk isn't loaded
+ */
+std::optional<Block> ChunkManager::get_block(const Vec3_t world_location) const
+{
+    Vec3_t chunk_location{};
+    Vec3_t block_location{};
+    get_relative_locations(Vec3_t{}, world_location, chunk_location, block_location);
 
-    // Color attribute
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(5 * sizeof(float)));
-    glEnableVertexAttribArray(2);
+    const auto chunk = this->GCL.find(ChunkMapKey(chunk_location));
+    if (chunk == nullptr)
+    {
+        return std::nullopt;
+    }
 
-    glBindVertexArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return chunk->get_block(block_location.x, block_location.y, block_location.z);
 }
 
-ChunkManager::~ChunkManager()
+/**
+ * @brief Places or removes (if __type__ is AIR) the block at __world_location__ on behalf of the player.
+ * The block is written through ChunkManager::set_blocks(), and the chunks it reports are marked dirty. Only
+ * the slices of their meshes that the edit touches are remeshed, once per frame by
+ * ChunkManager::bind_terrain_mesh(), so the edit is drawn on the same frame that it is made. Must be called
+ * from the main thread.
+ * Edits may reach past the chunks loaded for a column (see ChunkManager::get_column_z_range()), e.g. when
+ * building upwards or digging down. Such chunks are generated on the spot, and the column's range is widened
+ * to keep them loaded from then on. Edited chunks are kept in ChunkManager::chunk_cache once unloaded.
+ * @since 16-10-2026
+ * @param[in] world_location The location of the block, in world coordinates
+ * @param[in] type The type of block to place
+ * @returns OOB if the block's chunk isn't loaded and can't be generated, otherwise SUCCESS
+ */
+Result ChunkManager::edit_block(const Vec3_t world_location, const BlockType type)
 {
-    if (glIsBuffer(this->terrain_mesh.vbo))
+    Vec3_t chunk_location{};
+    Vec3_t block_location{};
+    get_relative_locations(Vec3_t{}, world_location, chunk_location, block_location);
+
+    auto chunk = find_or_generate_chunk(chunk_location);
+    if (chunk == nullptr)
     {
-        glDeleteBuffers(1, &this->terrain_mesh.vbo);
+        return Result::OOB;
+    }
+
+    // Removing a block exposes the blocks around it, which may lie within chunks that aren't loaded yet
+    if (type == BlockType::AIR)
+    {
+        for (size_t direction = 0; direction < KC::CUBE_FACES; ++direction)
+        {
+            Vec3_t neighbor_location = world_location;
+            neighbor_location.v[direction / 2] += (direction & 1) ? 1.0f : -1.0f;
+
+            Vec3_t neighbor_chunk_location{};
+            Vec3_t neighbor_block_location{};
+            get_relative_locations(Vec3_t{}, neighbor_location, neighbor_chunk_location, neighbor_block_location);
+            if (!this->GCL.contains(neighbor_chunk_location) && find_or_generate_chunk(neighbor_chunk_location) != nullptr)
+            {
+                widen_edited_z_range(neighbor_chunk_location);
+            }
+        }
     }
-    if (glIsVertexArray(this->terrain_mesh.vao))
+
+    const ChunkMap dirty_chunks = set_blocks({ DeferredBlock(chunk_location, block_location, type) });
+    if (!dirty_chunks.contains(chunk_location))
     {
-        glDeleteVertexArrays(1, &this->terrain_mesh.vao);
+        // The block was already of this type
+        return Result::SUCCESS;
     }
-}
 
-/**
- * @brief Entry point for accessing the singleton's instance.
- * @since 13-02-2025
- * @returns A reference to the single ChunkManager instance;
- */
-ChunkManager &ChunkManager::get_instance()
-{
-    static ChunkManager chunk_mgr;
-    return chunk_mgr;
+    mark_chunks_dirty(dirty_chunks);
+    chunk->is_edited = true;
+    widen_edited_z_range(chunk_location);
+
+    return Result::SUCCESS;
 }
 
 /**
@@ -73,8 +125,6 @@ Result ChunkManager::add_block(
     const bool overwrite
 ) const
 {
-    BlockFactory &block_factory = BlockFactory::get_instance();
-
     if (block_location.x < 0 || block_location.x >= KC::CHUNK_SIZE ||
         block_location.y < 0 || block_location.y >= KC::CHUNK_SIZE ||
         block_location.z < 0 || block_location.z >= KC::CHUNK_SIZE)
@@ -82,71 +132,77 @@ Result ChunkManager::add_block(
         return Result::OOB;
     }
 
-    Block &block = chunk->blocks[block_location.z][block_location.y][block_location.x];
-    if (!overwrite && block.type != BlockType::AIR)
+    const size_t x = block_location.x;
+    const size_t y = block_location.y;
+    const size_t z = block_location.z;
+
+    if (!overwrite && chunk->get_block(x, y, z).type != BlockType::AIR)
     {
         return Result::FAILURE;
     }
 
-    Vec3_t world_location = { .v = {
-         (chunk->location.x * KC::CHUNK_SIZE) + block_location.x,
-         (chunk->location.y * KC::CHUNK_SIZE) + block_location.y,
-         (chunk->location.z * KC::CHUNK_SIZE) + block_location.z
-    }};
-    block = block_factory.make_block(type, ALL, world_location);
+    Block block = (type == BlockType::AIR) ? Block() : Block(type, ALL);
 
     // Remove faces from block and its neighbors
-    if (block.type != BlockType::LEAVES)
+    auto cull_faces = [&](
+        const size_t nx,
+        const size_t ny,
+        const size_t nz,
+        const BlockFace face,
+        const BlockFace neighbor_face
+    )
+    {
+        Block neighbor = chunk->get_block(nx, ny, nz);
+        if (Chunk::is_occluder(neighbor.type))
+        {
+            UNSET_BIT(neighbor.faces, neighbor_face);
+            UNSET_BIT(block.faces, face);
+            chunk->set_block(nx, ny, nz, neighbor);
+        }
+    };
+
+    if (Chunk::is_occluder(block.type))
     {
-        if (block_location.x > 0 &&
-            chunk->blocks[block_location.z][block_location.y][block_location.x - 1].type != BlockType::AIR &&
-            chunk->blocks[block_location.z][block_location.y][block_location.x - 1].type != BlockType::LEAVES)
+        if (x > 0)
         {
-            UNSET_BIT(chunk->blocks[block_location.z][block_location.y][block_location.x - 1].faces, BACK);
-            UNSET_BIT(block.faces, FRONT);
+            cull_faces(x - 1, y, z, FRONT, BACK);
         }
-        if (block_location.x < (KC::CHUNK_SIZE - 1) &&
-            chunk->blocks[block_location.z][block_location.y][block_location.x + 1].type != BlockType::AIR &&
-            chunk->blocks[block_location.z][block_location.y][block_location.x + 1].type != BlockType::LEAVES)
+        if (x < (KC::CHUNK_SIZE - 1))
         {
-            UNSET_BIT(chunk->blocks[block_location.z][block_location.y][block_location.x + 1].faces, FRONT);
-            UNSET_BIT(block.faces, BACK);
+            cull_faces(x + 1, y, z, BACK, FRONT);
         }
-        if (block_location.y > 0 &&
-            chunk->blocks[block_location.z][block_location.y - 1][block_location.x].type != BlockType::AIR &&
-            chunk->blocks[block_location.z][block_location.y - 1][block_location.x].type != BlockType::LEAVES)
+        if (y > 0)
         {
-            UNSET_BIT(chunk->blocks[block_location.z][block_location.y - 1][block_location.x].faces, RIGHT);
-            UNSET_BIT(block.faces, LEFT);
+            cull_faces(x, y - 1, z, LEFT, RIGHT);
         }
-        if (block_location.y < (KC::CHUNK_SIZE - 1) &&
-            chunk->blocks[block_location.z][block_location.y + 1][block_location.x].type != BlockType::AIR &&
-            chunk->blocks[block_location.z][block_location.y + 1][block_location.x].type != BlockType::LEAVES)
+        if (y < (KC::CHUNK_SIZE - 1))
         {
-            UNSET_BIT(chunk->blocks[block_location.z][block_location.y + 1][block_location.x].faces, LEFT);
-            UNSET_BIT(block.faces, RIGHT);
+            cull_faces(x, y + 1, z, RIGHT, LEFT);
         }
-        if (block_location.z > 0 &&
-            chunk->blocks[block_location.z - 1][block_location.y][block_location.x].type != BlockType::AIR &&
-            chunk->blocks[block_location.z - 1][block_location.y][block_location.x].type != BlockType::LEAVES)
+        if (z > 0)
         {
-            UNSET_BIT(chunk->blocks[block_location.z - 1][block_location.y][block_location.x].faces, TOP);
-            UNSET_BIT(block.faces, BOTTOM);
+            cull_faces(x, y, z - 1, BOTTOM, TOP);
         }
-        if (block_location.z < (KC::CHUNK_SIZE - 1) &&
-            chunk->blocks[block_location.z + 1][block_location.y][block_location.x].type != BlockType::AIR &&
-            chunk->blocks[block_location.z + 1][block_location.y][block_location.x].type != BlockType::LEAVES)
+        if (z < (KC::CHUNK_SIZE - 1))
         {
-            UNSET_BIT(chunk->blocks[block_location.z + 1][block_location.y][block_location.x].faces, BOTTOM);
-            UNSET_BIT(block.faces, TOP);
+            cull_faces(x, y, z + 1, TOP, BOTTOM);
         }
     }
 
+    chunk->set_block(x, y, z, block);
+
+    // Blocks which can be seen through may replace opaque ones, exposing the faces around them
+    if (!Chunk::is_occluder(block.type))
+    {
+        expose_neighbor_faces(chunk, block_location);
+    }
+
     return Result::SUCCESS;
 }
 
 /**
  * @brief Removes a block at the location specified by __location__ relative to __chunk__'s location.
+ * The faces of the surrounding blocks which pointed at it are exposed, including those of neighboring chunks.
  * @since 13-02-2025
  * @param[in/out] chunk The chunk who's block is being removed
  * @param[in] block_location The location relative to __chunk__'s location where the block will be removed
@@ -154,112 +210,165 @@ Result ChunkManager::add_block(
  */
 Result ChunkManager::remove_block(std::shared_ptr<Chunk> &chunk, const Vec3_t block_location) const
 {
-    Block &block = chunk->blocks[block_location.z][block_location.y][block_location.x];
-    block = Block();
+    if (block_location.x < 0 || block_location.x >= KC::CHUNK_SIZE ||
+        block_location.y < 0 || block_location.y >= KC::CHUNK_SIZE ||
+        block_location.z < 0 || block_location.z >= KC::CHUNK_SIZE)
+    {
+        return Result::OOB;
+    }
 
-    // TODO: Regenerate neighboring block faces
+    chunk->set_block(block_location.x, block_location.y, block_location.z, Block());
+    expose_neighbor_faces(chunk, block_location);
 
     return Result::SUCCESS;
 }
 
 /**
- * @brief Plants a tree at the location specified by __root_location__ (+1 unit in the z direction).
- * @since 13-02-2025
- * @param[in/out] chunk The chunk in which the tree will be planted
- * @param[in] root_location The location relative to __chunk__'s location at which the tree will be planted
+ * @brief Writes a batch of blocks to the chunks of the GCL that they belong to.
+ * Blocks are grouped by chunk, so that each chunk is written and has its faces recomputed once.
+ * Blocks belonging to chunks which aren't loaded are dropped. Must be called from the main thread.
+ * @since 16-10-2026
+ * @param[in] block_list The blocks to write
+ * @param[in] is_structure If true, blocks only replace those they take precedence over (see
+ * PendingWrites::takes_precedence()) and chunks that the player has edited are left untouched, otherwise
+ * blocks are always replaced
+ * @returns The chunks whose meshes need updating, including neighboring chunks whose faces along the shared
+ * border were exposed or hidden. See ChunkManager::mark_chunks_dirty()
  */
-ChunkMap ChunkManager::plant_tree(std::shared_ptr<Chunk> &chunk, const Vec3_t root_location)
+ChunkMap ChunkManager::set_blocks(const std::vector<DeferredBlock> &block_list, const bool is_structure)
 {
-    auto deferred_list = ChunkMap{};
+    ChunkMap dirty_chunks;
+    std::unordered_map<ChunkMapKey, std::vector<BlockEdit>, ChunkMapHash> edits_by_chunk;
 
-    // Trunk
-    for (int i = 1; i <= 6; ++i)
+    for (const auto &block : block_list)
     {
-        Vec3_t block_location = { .v = { root_location.x, root_location.y, root_location.z + i }};
-        if (add_block(chunk, BlockType::WOOD, block_location, true) == Result::OOB)
-        {
-            auto deferred = add_block_relative(chunk, BlockType::WOOD, block_location);
-            deferred_list.insert(deferred);
-        }
+        edits_by_chunk[ChunkMapKey(block.chunk_location)].push_back(
+            BlockEdit{ .block_location = block.block_location, .type = block.type }
+        );
     }
 
-    // Leaves (two 5x5 layers)
-    for (int y = -2; y <= 2; ++y)
+    for (const auto &[chunk_key, edits] : edits_by_chunk)
     {
-        for (int x = -2; x <= 2; ++x)
+        // Structures would otherwise grow back the leaves and logs that the player removed
+        auto chunk = this->GCL.find(chunk_key);
+        if (chunk == nullptr || (is_structure && chunk->is_edited))
         {
-            if (x == 0 && y == 0)
-            {
-                continue;
-            }
+            continue;
+        }
 
-            Vec3_t block_location1 = { .v = { root_location.x + x, root_location.y + y, root_location.z + 4 }};
-            if (add_block(chunk, BlockType::LEAVES, block_location1, true) == Result::OOB)
-            {
-                auto deferred = add_block_relative(chunk, BlockType::LEAVES, block_location1);
-                deferred_list.insert(deferred);
-            }
-            Vec3_t block_location2 = { .v = { root_location.x + x, root_location.y + y, root_location.z + 5 }};
-            if (add_block(chunk, BlockType::LEAVES, block_location2, true) == Result::OOB)
-            {
-                auto deferred = add_block_relative(chunk, BlockType::LEAVES, block_location2);
-                deferred_list.insert(deferred);
-            }
+        uint8_t touched_borders = 0;
+        if (write_blocks(chunk, edits, is_structure, touched_borders))
+        {
+            collect_dirty_chunks(chunk, touched_borders, dirty_chunks);
         }
     }
 
-    // Leaves (first 3x3 layer)
-    for (int y = -1; y <= 1; ++y)
+    return dirty_chunks;
+}
+
+/**
+ * @brief Fills the box spanning __world_min__ to __world_max__ (inclusive) with blocks of type __type__.
+ * Each loaded chunk that the box overlaps is written and has its faces recomputed once. Parts of the box
+ * that lie within chunks which aren't loaded are skipped. Must be called from the main thread.
+ * @since 16-10-2026
+ * @param[in] world_min The lowest corner of the box, in world coordinates
+ * @param[in] world_max The highest corner of the box, in world coordinates
+ * @param[in] type The type of block to fill the box with (AIR clears it)
+ * @returns The chunks whose meshes need updating, see ChunkManager::set_blocks()
+ */
+ChunkMap ChunkManager::fill_box(const Vec3_t world_min, const Vec3_t world_max, const BlockType type)
+{
+    constexpr int N = KC::CHUNK_SIZE;
+
+    ChunkMap dirty_chunks;
+    int min[3];
+    int max[3];
+    int chunk_min[3];
+    int chunk_max[3];
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        min[axis] = (int)std::floor(std::min(world_min.v[axis], world_max.v[axis]));
+        max[axis] = (int)std::floor(std::max(world_min.v[axis], world_max.v[axis]));
+        chunk_min[axis] = (int)std::floor((float)min[axis] / N);
+        chunk_max[axis] = (int)std::floor((float)max[axis] / N);
+    }
+
+    auto edits = std::vector<BlockEdit>{};
+    for (int cz = chunk_min[2]; cz <= chunk_max[2]; ++cz)
     {
-        for (int x = -1; x <= 1; ++x)
+        for (int cy = chunk_min[1]; cy <= chunk_max[1]; ++cy)
         {
-            if (x == 0 && y == 0)
+            for (int cx = chunk_min[0]; cx <= chunk_max[0]; ++cx)
             {
-                continue;
-            }
+                auto chunk = this->GCL.find(ChunkMapKey(cx, cy, cz));
+                if (chunk == nullptr)
+                {
+                    continue;
+                }
 
-            Vec3_t block_location = { .v = { root_location.x + x, root_location.y + y, root_location.z + 6 }};
-            if (add_block(chunk, BlockType::LEAVES, block_location, true) == Result::OOB)
-            {
-                auto deferred = add_block_relative(chunk, BlockType::LEAVES, block_location);
-                deferred_list.insert(deferred);
+                // The part of the box that lies within the chunk, relative to the chunk
+                const int origin[3] = { cx * N, cy * N, cz * N };
+                int lo[3];
+                int hi[3];
+                for (size_t axis = 0; axis < 3; ++axis)
+                {
+                    lo[axis] = std::max(min[axis], origin[axis]) - origin[axis];
+                    hi[axis] = std::min(max[axis], origin[axis] + N - 1) - origin[axis];
+                }
+
+                edits.clear();
+                for (int z = lo[2]; z <= hi[2]; ++z)
+                {
+                    for (int y = lo[1]; y <= hi[1]; ++y)
+                    {
+                        for (int x = lo[0]; x <= hi[0]; ++x)
+                        {
+                            edits.push_back(BlockEdit{ .block_location = { .v = { (float)x, (float)y, (float)z }}, .type = type });
+                        }
+                    }
+                }
+
+                uint8_t touched_borders = 0;
+                if (write_blocks(chunk, edits, false, touched_borders))
+                {
+                    collect_dirty_chunks(chunk, touched_borders, dirty_chunks);
+                }
             }
         }
     }
 
-    // Leaves (second 3x3 layer is plus-shaped)
-    Vec3_t block_location1 = { .v = { root_location.x, root_location.y, root_location.z + 7 }};
-    if (add_block(chunk, BlockType::LEAVES, block_location1, true) == Result::OOB)
-    {
-        auto deferred = add_block_relative(chunk, BlockType::LEAVES, block_location1);
-        deferred_list.insert(deferred);
-    }
-    Vec3_t block_location2 = { .v = { root_location.x + 1, root_location.y, root_location.z + 7 }};
-    if (add_block(chunk, BlockType::LEAVES, block_location2, true) == Result::OOB)
-    {
-        auto deferred = add_block_relative(chunk, BlockType::LEAVES, block_location2);
-        deferred_list.insert(deferred);
-    }
-    Vec3_t block_location3 = { .v = { root_location.x - 1, root_location.y, root_location.z + 7 }};
-    if (add_block(chunk, BlockType::LEAVES, block_location3, true) == Result::OOB)
-    {
-        auto deferred = add_block_relative(chunk, BlockType::LEAVES, block_location3);
-        deferred_list.insert(deferred);
-    }
-    Vec3_t block_location4 = { .v = { root_location.x, root_location.y + 1, root_location.z + 7 }};
-    if (add_block(chunk, BlockType::LEAVES, block_location4, true) == Result::OOB)
-    {
-        auto deferred = add_block_relative(chunk, BlockType::LEAVES, block_location4);
-        deferred_list.insert(deferred);
-    }
-    Vec3_t block_location5 = { .v = { root_location.x, root_location.y - 1, root_location.z + 7 }};
-    if (add_block(chunk, BlockType::LEAVES, block_location5, true) == Result::OOB)
+    return dirty_chunks;
+}
+
+/**
+ * @brief Places __structure__ with its anchor on the block at __world_location__. The structure's blocks are
+ * written to the loaded chunks that it overlaps (other than those the player has edited), one pass per
+ * chunk, and recorded in
+ * ChunkManager::pending_writes so that they are placed again if their chunk is generated anew. Must be called
+ * from the main thread.
+ * @since 16-10-2026
+ * @param[in] structure The structure's template
+ * @param[in] world_location The location of the block that the structure's anchor sits on, in world coordinates
+ * @returns The chunks whose meshes need updating, see ChunkManager::set_blocks()
+ */
+ChunkMap ChunkManager::stamp_blocks(const StructureTemplate &structure, const Vec3_t world_location)
+{
+    Vec3_t chunk_location{};
+    Vec3_t block_location{};
+    get_relative_locations(Vec3_t{}, world_location, chunk_location, block_location);
+
+    auto edits = std::vector<BlockEdit>{};
+    auto block_list = std::vector<DeferredBlock>{};
+    structure.stamp(chunk_location, block_location, edits, block_list);
+
+    // The template splits its blocks between the anchor's chunk and the rest, but all of them are written alike
+    for (const auto &edit : edits)
     {
-        auto deferred = add_block_relative(chunk, BlockType::LEAVES, block_location5);
-        deferred_list.insert(deferred);
+        block_list.push_back(DeferredBlock(chunk_location, edit.block_location, edit.type));
     }
 
-    return deferred_list;
+    return apply_deferred_blocks(block_list);
 }
 
 /**
@@ -267,9 +376,28 @@ ChunkMap ChunkManager::plant_tree(std::shared_ptr<Chunk> &chunk, const Vec3_t ro
  *
  * TODO: Params
  */
-ChunkMap ChunkManager::plant_trees(std::shared_ptr<Chunk> &chunk, const float density)
+std::vector<DeferredBlock> ChunkManager::plant_trees(
+    std::shared_ptr<Chunk> &chunk,
+    const float density
+) const
 {
-    auto deferred_list = ChunkMap{};
+    auto edits = std::vector<BlockEdit>{};
+    auto deferred_list = std::vector<DeferredBlock>{};
+
+    // Every template named tree* is a variant, so new kinds of trees only need a new file in res/structures
+    auto trees = std::vector<const StructureTemplate*>{};
+    for (const auto &[name, structure] : this->structures)
+    {
+        if (name.starts_with("tree"))
+        {
+            trees.push_back(&structure);
+        }
+    }
+
+    if (trees.empty())
+    {
+        return deferred_list;
+    }
 
     for (size_t y = 0, _y = 1; y < KC::CHUNK_SIZE; ++y, ++_y)
     {
@@ -290,52 +418,766 @@ ChunkMap ChunkManager::plant_trees(std::shared_ptr<Chunk> &chunk, const float de
 
             if (normalized < density)
             {
-                auto deferred = plant_tree(chunk, root_location);
-                deferred_list.insert(deferred.begin(), deferred.end());
+                trees[hash % trees.size()]->stamp(chunk->location, root_location, edits, deferred_list);
             }
         }
     }
 
+    // Every tree is written at once, so the chunk's faces are only recomputed once
+    uint8_t touched_borders = 0;
+    write_blocks(chunk, edits, true, touched_borders);
+
     return deferred_list;
 }
 
+/**
+ * @brief Remeshes the dirty slices of the chunks marked by ChunkManager::mark_chunks_dirty() and uploads
+ * the meshes of chunks that have been modified to their range of the terrain arena. Since this happens once
+ * per frame, any number of edits made to a chunk within the frame cost a single remesh and upload. Chunks
+ * which weren't marked aren't visited, and chunks whose meshes are unchanged are left untouched on the GPU.
+ * @since 16-10-2026
+ */
 void ChunkManager::bind_terrain_mesh()
 {
-    // Check if any chunks have been modified
-    bool chunk_update_pending = std::any_of(
-        this->GCL.begin(),
-        this->GCL.end(),
-        [&](const auto &kv_pair)
+    const bool is_greedy = Settings::get_instance().greedy_meshing;
+
+    for (auto &chunk : this->dirty_chunks.values())
+    {
+        chunk->update_dirty_slices(is_greedy);
+        if (!chunk->update_pending)
         {
-            return kv_pair.second->update_pending;
+            continue;
         }
-    );
 
-    if (chunk_update_pending)
+        // The CPU-side vertices are kept, since later edits only regenerate the slices they touch
+        this->terrain_arena.upload(chunk->mesh_range, chunk->vertices);
+        chunk->update_pending = false;
+    }
+
+    // Released rather than cleared, since a frame that marks every chunk would leave a table the size of the GCL
+    this->dirty_chunks = ChunkMap();
+}
+
+/**
+ * @brief Marks __chunks__ to have their dirty slices remeshed and their meshes uploaded by
+ * ChunkManager::bind_terrain_mesh() at the end of the frame.
+ * @since 16-10-2026
+ * @param[in] chunks The loaded chunks whose meshes need updating
+ */
+void ChunkManager::mark_chunks_dirty(const ChunkMap &chunks)
+{
+    for (const auto &chunk : chunks.values())
+    {
+        this->dirty_chunks.insert(chunk);
+    }
+}
+
+/**
+ * @brief Collects the chunks which have a mesh and may be visible within __frustum__.
+ * Unless disabled in the settings, chunks which can't be seen through the non-opaque blocks between them
+ * and the camera, or which are hidden behind solid terrain, are skipped as well. See
+ * ChunkManager::cull_hidden_chunks() and ChunkManager::cull_occluded_chunks(). The amount of chunks that
+ * each pass removed is recorded within ChunkManager::culling_stats.
+ * @since 16-10-2026
+ * @param[in] frustum The camera's view frustum
+ * @param[in] m_view_proj The projection matrix multiplied by the view matrix (row-major)
+ * @param[in] v_eye The camera's location
+ * @param[out] draw_list The chunks to be drawn
+ */
+void ChunkManager::get_draw_list(
+    const Frustum &frustum,
+    const Mat4_t &m_view_proj,
+    const Vec3_t v_eye,
+    std::vector<Chunk*> &draw_list
+)
+{
+    Settings &settings = Settings::get_instance();
+
+    auto is_visible = std::vector<uint8_t>{};
+    frustum.cull(this->chunk_bounds, is_visible);
+
+    auto count_visible = [&]()
+    {
+        return (size_t)std::count(is_visible.begin(), is_visible.end(), 1);
+    };
+
+    this->culling_stats = CullingStats{};
+    this->culling_stats.chunks = is_visible.size();
+    size_t n_visible = count_visible();
+    this->culling_stats.frustum_culled = this->culling_stats.chunks - n_visible;
+    const auto is_in_frustum = is_visible;
+
+    if (settings.cave_culling)
+    {
+        cull_hidden_chunks(frustum, v_eye, is_visible);
+        this->culling_stats.cave_culled = n_visible - count_visible();
+        n_visible -= this->culling_stats.cave_culled;
+    }
+
+    if (settings.occlusion_culling)
+    {
+        cull_occluded_chunks(m_view_proj, is_in_frustum, is_visible);
+        this->culling_stats.occlusion_culled = n_visible - count_visible();
+    }
+
+    draw_list.clear();
+    for (size_t i = 0; i < is_visible.size(); ++i)
+    {
+        Chunk *chunk = this->chunk_bounds.chunks[i];
+        if (is_visible[i] && chunk->mesh_range.has_value() && chunk->mesh_range->count > 0)
+        {
+            draw_list.push_back(chunk);
+        }
+    }
+}
+
+/**
+ * @brief Hides the chunks which lie behind solid terrain.
+ * The solid part of every chunk within the frustum is rasterized into ChunkManager::occlusion_buffer as a
+ * few coarse boxes, one per quarter of the chunk's columns (see Chunk::solid_heights), which are stretched
+ * down through the fully solid chunks beneath them. Each remaining chunk's bounding box is then tested
+ * against the buffer.
+ * @since 16-10-2026
+ * @param[in] m_view_proj The projection matrix multiplied by the view matrix (row-major)
+ * @param[in] is_in_frustum Per bounding box of ChunkManager::chunk_bounds, whether it lies within the frustum
+ * @param[in/out] is_visible Per bounding box of ChunkManager::chunk_bounds, cleared for chunks which are hidden
+ */
+void ChunkManager::cull_occluded_chunks(
+    const Mat4_t &m_view_proj,
+    const std::vector<uint8_t> &is_in_frustum,
+    std::vector<uint8_t> &is_visible
+)
+{
+    constexpr int N = KC::CHUNK_SIZE;
+    constexpr int Q = N / 2;
+    const size_t bottom = Chunk::get_neighbor_index(2, false);
+    const size_t top = Chunk::get_neighbor_index(2, true);
+
+    this->occlusion_buffer.clear(m_view_proj, Settings::get_instance().znear);
+
+    for (size_t i = 0; i < is_in_frustum.size(); ++i)
+    {
+        if (!is_in_frustum[i])
+        {
+            continue;
+        }
+
+        const Chunk *chunk = this->chunk_bounds.chunks[i];
+        for (size_t quarter = 0; quarter < chunk->solid_heights.size(); ++quarter)
+        {
+            const int height = chunk->solid_heights[quarter];
+            if (height == 0)
+            {
+                continue;
+            }
+
+            // Fully solid quarters are covered by the box of the chunk above them
+            const Chunk *above = chunk->neighbors[top];
+            if (height == N && above != nullptr && above->solid_heights[quarter] > 0)
+            {
+                continue;
+            }
+
+            int depth = 0;
+            for (const Chunk *below = chunk->neighbors[bottom];
+                 below != nullptr && below->solid_heights[quarter] == N;
+                 below = below->neighbors[bottom])
+            {
+                depth += N;
+            }
+
+            const Vec3_t box_min = { .v = {
+                this->chunk_bounds.min_x[i] + ((quarter & 1) * Q),
+                this->chunk_bounds.min_y[i] + ((quarter >> 1) * Q),
+                this->chunk_bounds.min_z[i] - depth
+            }};
+            const Vec3_t box_max = { .v = { box_min.x + Q, box_min.y + Q, this->chunk_bounds.min_z[i] + height }};
+            this->occlusion_buffer.add_occluder(box_min, box_max);
+        }
+    }
+
+    for (size_t i = 0; i < is_visible.size(); ++i)
+    {
+        if (!is_visible[i])
+        {
+            continue;
+        }
+
+        const Vec3_t box_min = { .v = {
+            this->chunk_bounds.min_x[i],
+            this->chunk_bounds.min_y[i],
+            this->chunk_bounds.min_z[i]
+        }};
+        const Vec3_t box_max = { .v = {
+            this->chunk_bounds.max_x[i],
+            this->chunk_bounds.max_y[i],
+            this->chunk_bounds.max_z[i]
+        }};
+        is_visible[i] = this->occlusion_buffer.is_box_visible(box_min, box_max);
+    }
+}
+
+/**
+ * @brief Hides the chunks which can't be seen from the camera's chunk, e.g. caves enclosed by stone.
+ * Chunks are visited breadth-first from the camera's chunk. A chunk is entered through one of its faces, and
+ * may only be left through the faces connected to it (see Chunk::face_connectivity), in a direction which
+ * doesn't double back on any direction taken so far, and into a chunk within the frustum. Chunks which
+ * aren't loaded are treated as air, since most of them lie above the terrain.
+ * @since 16-10-2026
+ * @param[in] frustum The camera's view frustum
+ * @param[in] v_eye The camera's location
+ * @param[in/out] is_visible Per bounding box of ChunkManager::chunk_bounds, cleared for chunks which can't be seen
+ */
+void ChunkManager::cull_hidden_chunks(const Frustum &frustum, const Vec3_t v_eye, std::vector<uint8_t> &is_visible) const
+{
+    constexpr int N = KC::CHUNK_SIZE;
+    constexpr uint8_t ALL_FACES = (1 << KC::CUBE_FACES) - 1;
+
+    struct Step
     {
-        this->terrain_mesh.vertices.clear();
-        for (auto &chunk : this->GCL.values())
+        int x, y, z;          // Location of the chunk
+        Chunk *chunk;         // The chunk, or nullptr if it isn't loaded
+        uint8_t exits;        // Faces that the chunk may be left through
+        uint8_t directions;   // Directions taken to reach the chunk
+    };
+
+    if (this->chunk_bounds.size() == 0)
+    {
+        return;
+    }
+
+    // Visited chunks are tracked within a grid spanning the render distance and the loaded chunks' heights.
+    // Blocks are centered on integer coordinates, so each chunk starts half a block before its origin
+    const int radius = (int)Settings::get_instance().render_distance + 1;
+    const int eye[3] = {
+        (int)std::floor((v_eye.x + 0.5f) / N),
+        (int)std::floor((v_eye.y + 0.5f) / N),
+        (int)std::floor((v_eye.z + 0.5f) / N)
+    };
+    const auto [z_lo, z_hi] = std::ranges::minmax(this->chunk_bounds.min_z);
+    const int grid_min[3] = { eye[0] - radius, eye[1] - radius, std::min((int)std::floor((z_lo + 0.5f) / N), eye[2]) - 1 };
+    const int grid_max[3] = { eye[0] + radius, eye[1] + radius, std::max((int)std::floor((z_hi + 0.5f) / N), eye[2]) + 1 };
+    const int dims[3] = {
+        grid_max[0] - grid_min[0] + 1,
+        grid_max[1] - grid_min[1] + 1,
+        grid_max[2] - grid_min[2] + 1
+    };
+
+    auto get_cell = [&](const int x, const int y, const int z) -> int
+    {
+        if (x < grid_min[0] || x > grid_max[0] || y < grid_min[1] || y > grid_max[1] || z < grid_min[2] || z > grid_max[2])
         {
-            chunk->update_pending = false;
-            if (!chunk->vertices.empty())
+            return -1;
+        }
+        return (((z - grid_min[2]) * dims[1]) + (y - grid_min[1])) * dims[0] + (x - grid_min[0]);
+    };
+
+    auto visited = std::vector<uint8_t>(dims[0] * dims[1] * dims[2], 0);
+    auto queue = std::vector<Step>{};
+
+    Chunk *eye_chunk = this->GCL.find(ChunkMapKey(eye[0], eye[1], eye[2])).get();
+    visited[get_cell(eye[0], eye[1], eye[2])] = 1;
+    queue.push_back(Step{ eye[0], eye[1], eye[2], eye_chunk, ALL_FACES, 0 });
+
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        const Step step = queue[head];
+
+        for (size_t direction = 0; direction < KC::CUBE_FACES; ++direction)
+        {
+            if (!IS_BIT_SET(step.exits, 1 << direction) || IS_BIT_SET(step.directions, 1 << (direction ^ 1)))
+            {
+                continue;
+            }
+
+            int next[3] = { step.x, step.y, step.z };
+            next[direction / 2] += (direction & 1) ? 1 : -1;
+
+            const int cell = get_cell(next[0], next[1], next[2]);
+            if (cell < 0 || visited[cell])
             {
-                this->terrain_mesh.vertices.insert(
-                    this->terrain_mesh.vertices.end(),
-                    chunk->vertices.begin(),
-                    chunk->vertices.end()
-                );
+                continue;
             }
+
+            const Vec3_t box_min = { .v = {
+                (float)(next[0] * N) - 0.5f,
+                (float)(next[1] * N) - 0.5f,
+                (float)(next[2] * N) - 0.5f
+            }};
+            const Vec3_t box_max = { .v = { box_min.x + N, box_min.y + N, box_min.z + N }};
+            if (!frustum.intersects_box(box_min, box_max))
+            {
+                continue;
+            }
+            visited[cell] = 1;
+
+            Chunk *chunk = (step.chunk != nullptr)
+                ? step.chunk->neighbors[direction]
+                : this->GCL.find(ChunkMapKey(next[0], next[1], next[2])).get();
+
+            // The faces connected to the one the chunk is entered through
+            const uint8_t exits = (chunk != nullptr) ? chunk->face_connectivity[direction ^ 1] : ALL_FACES;
+            queue.push_back(Step{ next[0], next[1], next[2], chunk, exits, (uint8_t)(step.directions | (1 << direction)) });
         }
+    }
 
-        // Bind mesh to VBO
-        glBindBuffer(GL_ARRAY_BUFFER, this->terrain_mesh.vbo);
-        glBufferData(
-            GL_ARRAY_BUFFER,
-            this->terrain_mesh.vertices.size() * sizeof(Vertex),
-            this->terrain_mesh.vertices.data(),
-            GL_STATIC_DRAW
-        );
-        glBindBuffer(0, this->terrain_mesh.vbo);
+    for (size_t i = 0; i < is_visible.size(); ++i)
+    {
+        const Vec3_t &location = this->chunk_bounds.chunks[i]->location;
+        const int cell = get_cell(location.x, location.y, location.z);
+        if (cell >= 0 && !visited[cell])
+        {
+            is_visible[i] = 0;
+        }
+    }
+}
+
+/**
+ * @brief Inserts __chunk__ into the GCL and links it with its loaded neighbors.
+ * Chunks must only be added to the GCL through this function, so that Chunk::neighbors stays valid.
+ * @since 16-10-2026
+ * Faces along the borders between __chunk__ and its neighbors that are now hidden are marked to be remeshed.
+ * Terrain generation assumes that neighboring chunks hold generated terrain, so faces pointing into a chunk
+ * that the player has edited are recomputed along the border they share.
+ * @param[in] chunk The chunk being loaded
+ */
+void ChunkManager::load_chunk(const std::shared_ptr<Chunk> &chunk)
+{
+    const auto chunk_key = ChunkMapKey(chunk->location);
+    if (this->GCL.contains(chunk_key))
+    {
+        return;
+    }
+
+    this->GCL.insert(chunk);
+    this->chunk_bounds.insert(chunk.get());
+    this->dirty_chunks.insert(chunk);
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        for (const int direction : { -1, 1 })
+        {
+            int offset[3] = { 0, 0, 0 };
+            offset[axis] = direction;
+            const auto neighbor_key = ChunkMapKey(
+                chunk_key.x + offset[0],
+                chunk_key.y + offset[1],
+                chunk_key.z + offset[2]
+            );
+
+            const size_t i = Chunk::get_neighbor_index(axis, direction > 0);
+            auto neighbor = this->GCL.find(neighbor_key);
+            chunk->neighbors[i] = neighbor.get();
+            if (neighbor == nullptr)
+            {
+                continue;
+            }
+
+            neighbor->neighbors[i ^ 1] = chunk.get();
+            if (neighbor->is_edited)
+            {
+                expose_border_faces(*chunk, axis, direction);
+            }
+            if (chunk->is_edited)
+            {
+                expose_border_faces(*neighbor, axis, -direction);
+            }
+            if (chunk->has_hidden_border_faces(i))
+            {
+                chunk->mark_slice_dirty(i, (direction > 0) ? KC::CHUNK_SIZE - 1 : 0);
+            }
+            if (neighbor->has_hidden_border_faces(i ^ 1))
+            {
+                neighbor->mark_slice_dirty(i ^ 1, (direction > 0) ? 0 : KC::CHUNK_SIZE - 1);
+            }
+            if (neighbor->is_dirty())
+            {
+                this->dirty_chunks.insert(neighbor);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Recomputes the faces of __chunk__'s blocks along its border in __direction__ of __axis__, enabling
+ * those that point at blocks of the neighboring chunk which aren't opaque. See Chunk::update_faces().
+ * @since 16-10-2026
+ * @param[in/out] chunk The chunk
+ * @param[in] axis The axis that the border lies across
+ * @param[in] direction Whether the border lies towards -axis (-1) or +axis (1)
+ */
+void ChunkManager::expose_border_faces(Chunk &chunk, const size_t axis, const int direction) const
+{
+    auto min = std::array<int, 3>{ 0, 0, 0 };
+    auto max = std::array<int, 3>{ KC::CHUNK_SIZE - 1, KC::CHUNK_SIZE - 1, KC::CHUNK_SIZE - 1 };
+    min[axis] = max[axis] = (direction > 0) ? KC::CHUNK_SIZE - 1 : 0;
+
+    chunk.update_faces(min, max);
+}
+
+/**
+ * @brief Removes the chunk at __chunk_location__ from the GCL, unlinks it from its neighbors,
+ * and releases its GPU resources. Chunks that the player has edited are moved to ChunkManager::chunk_cache.
+ * @since 16-10-2026
+ * @param[in] chunk_location The location of the chunk being unloaded
+ */
+void ChunkManager::unload_chunk(const Vec3_t chunk_location)
+{
+    const auto chunk_key = ChunkMapKey(chunk_location);
+    auto chunk = this->GCL.find(chunk_key);
+    if (chunk == nullptr)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < chunk->neighbors.size(); ++i)
+    {
+        if (chunk->neighbors[i] != nullptr)
+        {
+            chunk->neighbors[i]->neighbors[i ^ 1] = nullptr;
+        }
+    }
+    chunk->neighbors.fill(nullptr);
+
+    this->terrain_arena.release(chunk->mesh_range);
+    this->chunk_bounds.erase(chunk_key);
+    this->GCL.erase(chunk_key);
+    this->dirty_chunks.erase(chunk_key);
+
+    if (chunk->is_edited)
+    {
+        this->chunk_cache.insert(chunk);
+    }
+}
+
+/**
+ * @brief Generates and meshes the chunk at __chunk_location__, or only meshes __cached__ if the player had
+ * edited it before it was unloaded. Trees are planted within a new chunk, and any of their blocks that fall
+ * outside of it are returned alongside the chunk. Blocks which neighboring trees have already left for it
+ * are placed before it is meshed. Doesn't touch the GCL, so it is safe to call from a worker thread.
+ * @since 16-10-2026
+ * @param[in] chunk_location The location of the chunk
+ * @param[in] cached The chunk taken from ChunkManager::chunk_cache, or nullptr if there isn't one
+ * @param[in] is_greedy Whether coplanar faces should be merged, see Chunk::update_mesh()
+ * @returns The generated chunk, to be inserted by ChunkManager::insert_generated_chunk()
+ */
+GeneratedChunk ChunkManager::generate_chunk(
+    const Vec3_t chunk_location,
+    const std::shared_ptr<Chunk> &cached,
+    const bool is_greedy
+) const
+{
+    auto generated = GeneratedChunk{};
+    generated.is_greedy = is_greedy;
+
+    if (cached != nullptr)
+    {
+        generated.chunk = cached;
+    }
+    else
+    {
+        generated.chunk = ChunkFactory::get_instance().make_chunk(chunk_location);
+
+        // Plant trees
+        if (chunk_location.z > ((float)KC::SEA_LEVEL / KC::CHUNK_SIZE))
+        {
+            generated.deferred = plant_trees(generated.chunk);
+        }
+        apply_pending_blocks(generated.chunk);
+    }
+
+    generated.chunk->update_mesh(is_greedy);
+
+    return generated;
+}
+
+/**
+ * @brief Inserts a chunk returned by ChunkManager::generate_chunk() into the GCL, along with the blocks its
+ * trees left for other chunks. Any slices that change as a result are remeshed by
+ * ChunkManager::bind_terrain_mesh(). Must be called from the main thread.
+ * @since 16-10-2026
+ * @param[in/out] generated The generated chunk
+ */
+void ChunkManager::insert_generated_chunk(GeneratedChunk &generated)
+{
+    auto &chunk = generated.chunk;
+
+    // The meshing mode may have been switched whilst the chunk was being generated
+    const bool is_greedy = Settings::get_instance().greedy_meshing;
+    if (generated.is_greedy != is_greedy)
+    {
+        chunk->update_mesh(is_greedy);
+    }
+
+    // Neighbors' trees may have left blocks for the chunk whilst it was being generated. Edited chunks
+    // already hold them, and replaying them would undo the player's edits
+    if (!chunk->is_edited)
+    {
+        apply_pending_blocks(chunk);
+    }
+
+    // Loading the chunk may hide faces along its borders, as may the overhanging blocks of its own trees
+    load_chunk(chunk);
+    mark_chunks_dirty(apply_deferred_blocks(generated.deferred));
+}
+
+/**
+ * @brief Retrieves the loaded chunk at __chunk_location__. If it isn't loaded but the chunk directly above
+ * or below it is, it is generated (or taken from ChunkManager::chunk_cache) and loaded on the spot. Chunks
+ * of columns that aren't loaded are never generated, since they would be left behind when the column unloads.
+ * Must be called from the main thread.
+ * @since 16-10-2026
+ * @param[in] chunk_location The location of the chunk
+ * @returns The chunk, or nullptr if it isn't loaded and can't be generated
+ */
+std::shared_ptr<Chunk> ChunkManager::find_or_generate_chunk(const Vec3_t chunk_location)
+{
+    const auto chunk_key = ChunkMapKey(chunk_location);
+    auto chunk = this->GCL.find(chunk_key);
+    if (chunk != nullptr)
+    {
+        return chunk;
+    }
+
+    const bool is_column_loaded =
+        this->GCL.contains(ChunkMapKey(chunk_key.x, chunk_key.y, chunk_key.z - 1)) ||
+        this->GCL.contains(ChunkMapKey(chunk_key.x, chunk_key.y, chunk_key.z + 1));
+    if (!is_column_loaded ||
+        chunk_key.z < 0 ||
+        chunk_key.z > (int)(KC::MAX_BLOCK_HEIGHT / KC::CHUNK_SIZE) ||
+        this->in_flight.contains(chunk_key))
+    {
+        return nullptr;
+    }
+
+    auto generated = generate_chunk(chunk_location, take_cached_chunk(chunk_key), Settings::get_instance().greedy_meshing);
+    insert_generated_chunk(generated);
+
+    return generated.chunk;
+}
+
+/**
+ * @brief Submits __chunk_location__ to the worker pool to be generated and meshed in the background, see
+ * ChunkManager::generate_chunk() and ChunkManager::take_generated_chunks().
+ * The meshing mode is read from the settings here rather than by the worker, since the settings may be
+ * changed on the main thread at any time.
+ * @since 16-10-2026
+ * @param[in] chunk_location The location of the chunk to be generated
+ */
+void ChunkManager::queue_chunk(const Vec3_t chunk_location)
+{
+    const bool is_greedy = Settings::get_instance().greedy_meshing;
+    const auto chunk_key = ChunkMapKey(chunk_location);
+
+    // The worker takes ownership of a cached chunk, so it is removed from the cache up front
+    auto cached = take_cached_chunk(chunk_key);
+    this->in_flight.insert(chunk_key);
+
+    this->workers.submit([this, chunk_location, is_greedy, cached]()
+    {
+        auto generated = generate_chunk(chunk_location, cached, is_greedy);
+
+        std::lock_guard<std::mutex> lock(this->generated_mutex);
+        this->generated_chunks.push_back(std::move(generated));
+    });
+}
+
+/**
+ * @brief Stops the worker pool, waiting for the chunks currently being generated and discarding the rest.
+ * Must be called before returning from main(), since the workers rely on singletons (e.g. ChunkFactory,
+ * HeightmapCache) which may be destroyed before ChunkManager is.
+ * @since 16-10-2026
+ */
+void ChunkManager::stop_workers()
+{
+    this->workers.stop();
+}
+
+/**
+ * @brief Checks whether __chunk_location__ has been queued but not yet collected.
+ * @since 16-10-2026
+ * @param[in] chunk_location The location of the chunk
+ * @returns True if the chunk is being generated, otherwise returns false
+ */
+bool ChunkManager::is_chunk_queued(const Vec3_t chunk_location) const
+{
+    return this->in_flight.contains(ChunkMapKey(chunk_location));
+}
+
+/**
+ * @brief Retrieves the amount of chunks that have been queued but not yet collected.
+ * @since 16-10-2026
+ * @returns The amount of chunks being generated
+ */
+size_t ChunkManager::get_queued_count() const
+{
+    return this->in_flight.size();
+}
+
+/**
+ * @brief Retrieves the maximum amount of chunks that should be queued at once in order to keep every worker busy.
+ * @since 16-10-2026
+ * @returns The amount of chunks
+ */
+size_t ChunkManager::get_queue_capacity() const
+{
+    return this->workers.size() * 2;
+}
+
+/**
+ * @brief Collects every chunk which the worker pool has finished generating since the last call.
+ * @since 16-10-2026
+ * @returns The generated chunks. They have not yet been inserted into the GCL
+ */
+std::vector<GeneratedChunk> ChunkManager::take_generated_chunks()
+{
+    auto generated = std::vector<GeneratedChunk>{};
+    {
+        std::lock_guard<std::mutex> lock(this->generated_mutex);
+        generated.swap(this->generated_chunks);
+    }
+
+    for (const auto &gen : generated)
+    {
+        this->in_flight.erase(ChunkMapKey(gen.chunk->location));
+    }
+
+    return generated;
+}
+
+/**
+ * @brief Calculates the range of chunks within __column__ which need to be loaded.
+ * Chunks that lie entirely above the surface (plus room for structures such as trees) are empty, and
+ * chunks that lie entirely beneath the lowest exposed block are never seen, so only the band between
+ * them is loaded, widened to include any chunks of the column that the player has edited.
+ * @since 16-10-2026
+ * @param[in] column The chunk column
+ * @returns The lowest and highest chunk z coordinates (inclusive) to be loaded
+ */
+std::pair<int, int> ChunkManager::get_column_z_range(const ChunkColumn column) const
+{
+    // The border is included since blocks are exposed wherever a neighboring column is lower
+    auto block_heights = std::vector<std::vector<uint8_t>>(
+        KC::CHUNK_SIZE + 2,
+        std::vector<uint8_t>(KC::CHUNK_SIZE + 2)
+    );
+    HeightmapCache::get_instance().get_bordered(column, block_heights);
+    const auto [lo, hi] = std::ranges::minmax(block_heights | std::views::join);
+
+    int z_min = lo / KC::CHUNK_SIZE;
+    int z_max = std::min(hi + KC::STRUCTURE_HEADROOM, KC::MAX_BLOCK_HEIGHT) / KC::CHUNK_SIZE;
+
+    auto needle = this->edited_z_ranges.find(column);
+    if (needle != this->edited_z_ranges.end())
+    {
+        z_min = std::min(z_min, needle->second.first);
+        z_max = std::max(z_max, needle->second.second);
+    }
+
+    return std::make_pair(z_min, z_max);
+}
+
+/**
+ * @brief Records blocks which were generated by a chunk's structures but belong to other chunks.
+ * Blocks are placed immediately in chunks that are already loaded, and otherwise when their chunk is
+ * generated. Chunks that the player has edited are never written to, since they already hold every block
+ * that was placed in them, minus those the player removed. Must be called from the main thread.
+ * @since 16-10-2026
+ * @param[in] deferred_list The blocks to place
+ * @returns The loaded chunks whose meshes need updating, see ChunkManager::set_blocks()
+ */
+ChunkMap ChunkManager::apply_deferred_blocks(const std::vector<DeferredBlock> &deferred_list)
+{
+    // Kept even if the chunk is loaded, in case it is unloaded and generated again later on
+    for (const auto &deferred : deferred_list)
+    {
+        this->pending_writes.add(deferred);
+    }
+
+    return set_blocks(deferred_list, true);
+}
+
+/**
+ * @brief Places the blocks that neighboring structures have left for __chunk__.
+ * Blocks which were already placed are unaffected, so this may be called more than once per chunk.
+ * @since 16-10-2026
+ * @param[in/out] chunk The chunk that the blocks belong to
+ * @returns True if any of __chunk__'s blocks changed, otherwise returns false
+ */
+bool ChunkManager::apply_pending_blocks(std::shared_ptr<Chunk> &chunk) const
+{
+    auto edits = std::vector<BlockEdit>{};
+
+    for (const auto &pending : this->pending_writes.get(chunk->location))
+    {
+        edits.push_back(BlockEdit{ .block_location = pending.block_location, .type = pending.type });
+    }
+
+    uint8_t touched_borders = 0;
+    return write_blocks(chunk, edits, true, touched_borders);
+}
+
+/**
+ * @brief Removes the chunk at __chunk_key__ from ChunkManager::chunk_cache.
+ * @since 16-10-2026
+ * @param[in] chunk_key The location of the chunk
+ * @returns The chunk, or nullptr if it wasn't cached
+ */
+std::shared_ptr<Chunk> ChunkManager::take_cached_chunk(const ChunkMapKey &chunk_key)
+{
+    auto chunk = this->chunk_cache.find(chunk_key);
+    if (chunk != nullptr)
+    {
+        this->chunk_cache.erase(chunk_key);
+    }
+
+    return chunk;
+}
+
+/**
+ * @brief Widens the range of chunks loaded for the column of __chunk_location__ to include it, see
+ * ChunkManager::get_column_z_range().
+ * @since 16-10-2026
+ * @param[in] chunk_location The location of a chunk that the player has edited or exposed
+ */
+void ChunkManager::widen_edited_z_range(const Vec3_t chunk_location)
+{
+    const auto column = ChunkColumn{ (int)chunk_location.x, (int)chunk_location.y };
+    const int z = (int)chunk_location.z;
+
+    const auto [needle, is_inserted] = this->edited_z_ranges.try_emplace(column, z, z);
+    needle->second.first = std::min(needle->second.first, z);
+    needle->second.second = std::max(needle->second.second, z);
+}
+
+/**
+ * @brief Enables the faces of the blocks surrounding __block_location__ which point towards it, including
+ * those of neighboring chunks. Used once the block can be seen through.
+ * @since 16-10-2026
+ * @param[in/out] chunk The chunk containing the block
+ * @param[in] block_location The location of the block, relative to __chunk__
+ */
+void ChunkManager::expose_neighbor_faces(std::shared_ptr<Chunk> &chunk, const Vec3_t block_location) const
+{
+    for (size_t direction = 0; direction < KC::CUBE_FACES; ++direction)
+    {
+        int pos[3] = { (int)block_location.x, (int)block_location.y, (int)block_location.z };
+        pos[direction / 2] += (direction & 1) ? 1 : -1;
+
+        Chunk *neighbor = chunk->find_relative(pos[0], pos[1], pos[2]);
+        if (neighbor == nullptr)
+        {
+            continue;
+        }
+
+        Block block = neighbor->get_block(pos[0], pos[1], pos[2]);
+        if (block.type == BlockType::AIR || IS_BIT_SET(block.faces, Chunk::get_neighbor_face(direction ^ 1)))
+        {
+            continue;
+        }
+
+        SET_BIT(block.faces, Chunk::get_neighbor_face(direction ^ 1));
+        neighbor->set_block(pos[0], pos[1], pos[2], block);
     }
 }
 
@@ -356,46 +1198,122 @@ void ChunkManager::get_relative_locations(
 }
 
 /**
- * @brief Adds a block relative to the current chunk.
- * This function is used when we calculate a block position that is outside of the current chunk bound and
- * want to add it to the correct parent chunk.
- * @warning If the parent chunk does not exist, it will be created, though the mesh will not be updated.
- * @param[in] block_factory Reference to a BlockFactory object
- * @param[in] chunk_location Location of the current chunk as a vec3
- * @param[in] block_location Location of the block to be placed, relative to the current chunk, as a vec3
- * @param[in] type The type of block that will be created
+ * @brief Adds __chunk__ to __dirty_chunks__, along with the loaded neighbors whose shared border it touched.
+ * @since 16-10-2026
+ * @param[in] chunk A chunk whose blocks changed
+ * @param[in] touched_borders The borders of __chunk__ along which blocks changed, see ChunkManager::write_blocks()
+ * @param[in/out] dirty_chunks The chunks whose meshes need updating
  */
-std::shared_ptr<Chunk> ChunkManager::add_block_relative(
+void ChunkManager::collect_dirty_chunks(
+    const std::shared_ptr<Chunk> &chunk,
+    const uint8_t touched_borders,
+    ChunkMap &dirty_chunks
+) const
+{
+    dirty_chunks.insert(chunk);
+
+    const auto chunk_key = ChunkMapKey(chunk->location);
+    for (size_t i = 0; i < KC::CUBE_FACES; ++i)
+    {
+        if (!IS_BIT_SET(touched_borders, (uint8_t)(1 << i)) || chunk->neighbors[i] == nullptr)
+        {
+            continue;
+        }
+
+        int offset[3] = { 0, 0, 0 };
+        offset[i / 2] = (i & 1) ? 1 : -1;
+        auto neighbor = this->GCL.find(ChunkMapKey(
+            chunk_key.x + offset[0],
+            chunk_key.y + offset[1],
+            chunk_key.z + offset[2]
+        ));
+        if (neighbor != nullptr)
+        {
+            dirty_chunks.insert(neighbor);
+        }
+    }
+}
+
+/**
+ * @brief Writes a batch of blocks which all lie within __chunk__, then recomputes the faces of each written
+ * block and of the blocks sharing a face with it, see Chunk::update_faces(). Blocks that several writes
+ * touch are only recomputed once, and the untouched blocks between sparse writes (such as the air around a
+ * tree's leaves) are skipped entirely.
+ * @since 16-10-2026
+ * @param[in/out] chunk The chunk being edited
+ * @param[in] edits The blocks to write, relative to __chunk__
+ * @param[in] is_structure If true, blocks only replace those they take precedence over (see
+ * PendingWrites::takes_precedence()), otherwise blocks are always replaced
+ * @param[out] touched_borders Bit i is set if a block along the border shared with Chunk::neighbors[i] changed,
+ * in which case the neighbor's faces or slices may have changed as well
+ * @returns True if any of __chunk__'s blocks changed, otherwise returns false
+ */
+bool ChunkManager::write_blocks(
     std::shared_ptr<Chunk> &chunk,
-    const BlockType type,
-    const Vec3_t block_location
-)
+    const std::vector<BlockEdit> &edits,
+    const bool is_structure,
+    uint8_t &touched_borders
+) const
 {
-    ChunkFactory &chunk_factory = ChunkFactory::get_instance();
+    constexpr int N = KC::CHUNK_SIZE;
+    constexpr int W = N + 2;
 
-    Vec3_t actual_chunk_location{};
-    Vec3_t actual_block_location{};
-    get_relative_locations(
-        chunk->location,
-        block_location,
-        actual_chunk_location,
-        actual_block_location
-    );
+    // Blocks whose faces need recomputing, including those just outside of the chunk
+    auto is_stale = std::array<uint8_t, W * W * W>{};
+    auto stale = std::vector<std::array<int, 3>>{};
+    auto mark_stale = [&](const std::array<int, 3> &pos)
+    {
+        const size_t i = ((pos[2] + 1) * W * W) + ((pos[1] + 1) * W) + (pos[0] + 1);
+        if (!is_stale[i])
+        {
+            is_stale[i] = 1;
+            stale.push_back(pos);
+        }
+    };
 
-    auto needle = this->GCL.find(actual_chunk_location);
-    if (needle != nullptr)
+    for (const auto &edit : edits)
     {
-        // Use existing chunk
-        add_block(needle, type, actual_block_location, false);
-        return needle;
+        const auto pos = std::array<int, 3>{
+            (int)edit.block_location.x,
+            (int)edit.block_location.y,
+            (int)edit.block_location.z
+        };
+        const Block existing = chunk->get_block(pos[0], pos[1], pos[2]);
+        const bool is_replaced = is_structure
+            ? PendingWrites::takes_precedence(edit.type, existing.type)
+            : (edit.type != existing.type);
+
+        if (!is_replaced)
+        {
+            continue;
+        }
+
+        chunk->set_block(pos[0], pos[1], pos[2], (edit.type == BlockType::AIR) ? Block() : Block(edit.type, ALL));
+
+        // Only the block itself and the blocks that share a face with it can have had their faces change
+        mark_stale(pos);
+        for (size_t direction = 0; direction < KC::CUBE_FACES; ++direction)
+        {
+            auto adjacent = pos;
+            adjacent[direction / 2] += (direction & 1) ? 1 : -1;
+            mark_stale(adjacent);
+
+            if (adjacent[direction / 2] < 0 || adjacent[direction / 2] >= N)
+            {
+                SET_BIT(touched_borders, (uint8_t)(1 << direction));
+            }
+        }
     }
-    else
+
+    if (stale.empty())
+    {
+        return false;
+    }
+
+    for (const auto &pos : stale)
     {
-        // Create new chunk
-        auto new_chunk = chunk_factory.make_chunk(actual_chunk_location);
-        add_block(new_chunk, type, actual_block_location, false);
-        new_chunk->tree_ref = chunk;
-        this->GCL.insert(new_chunk);
-        return new_chunk;
+        chunk->update_faces(pos, pos);
     }
+
+    return true;
 }
@@ -0,0 +1,171 @@
+/**
+ * @file chunk_map.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief A hash map of chunks keyed by their integer chunk coordinates.
+ * Keys are packed into 64-bit integers and stored in a single open-addressed table using linear probing,
+ * so a lookup scans one contiguous run of integers rather than chasing a bucket's linked list. Erasure
+ * shifts the following run backwards instead of leaving tombstones, so probe lengths never degrade over
+ * time as chunks stream in and out.
+ */
+
+#include "chunk_map.hpp"
+
+/**
+ * @brief Retrieves the amount of chunks stored within the map.
+ * @since 16-10-2026
+ * @returns The amount of chunks
+ */
+size_t ChunkMap::size() const
+{
+    return this->count;
+}
+
+/**
+ * @brief Removes every chunk from the map. The table's capacity is retained.
+ * @since 16-10-2026
+ */
+void ChunkMap::clear()
+{
+    std::fill(this->keys_packed.begin(), this->keys_packed.end(), EMPTY);
+    std::fill(this->chunks.begin(), this->chunks.end(), nullptr);
+    this->count = 0;
+}
+
+/**
+ * @brief Inserts __chunk__ at its location, unless a chunk already occupies it.
+ * @since 16-10-2026
+ * @param[in] chunk The chunk to insert
+ */
+void ChunkMap::insert(const std::shared_ptr<Chunk> &chunk)
+{
+    // Keep the load factor at or below 1/2, which keeps probe sequences short
+    if ((this->count + 1) * 2 > this->keys_packed.size())
+    {
+        grow();
+    }
+
+    const uint64_t packed = ChunkMapKey(chunk->location).pack();
+    const size_t slot = get_slot(packed);
+    if (this->keys_packed[slot] == EMPTY)
+    {
+        this->keys_packed[slot] = packed;
+        this->chunks[slot] = chunk;
+        ++this->count;
+    }
+}
+
+/**
+ * @brief Removes the chunk located at __chunk_key__ (if any).
+ * @since 16-10-2026
+ * @param[in] chunk_key The location of the chunk
+ * @returns True if a chunk was removed, otherwise returns false
+ */
+bool ChunkMap::erase(const ChunkMapKey &chunk_key)
+{
+    if (this->keys_packed.empty())
+    {
+        return false;
+    }
+
+    size_t hole = get_slot(chunk_key.pack());
+    if (this->keys_packed[hole] == EMPTY)
+    {
+        return false;
+    }
+
+    this->keys_packed[hole] = EMPTY;
+    this->chunks[hole] = nullptr;
+    --this->count;
+
+    // Shift later entries of the run back into the hole, unless doing so would place them before their home slot
+    const size_t mask = this->keys_packed.size() - 1;
+    for (size_t i = (hole + 1) & mask; this->keys_packed[i] != EMPTY; i = (i + 1) & mask)
+    {
+        const size_t home = hash64(this->keys_packed[i]) & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+            this->keys_packed[hole] = this->keys_packed[i];
+            this->chunks[hole] = std::move(this->chunks[i]);
+            this->keys_packed[i] = EMPTY;
+            hole = i;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Retrieves the chunk located at __chunk_key__.
+ * @since 16-10-2026
+ * @param[in] chunk_key The location of the chunk
+ * @returns The chunk, or nullptr if it isn't in the map
+ */
+std::shared_ptr<Chunk> ChunkMap::find(const ChunkMapKey &chunk_key) const
+{
+    if (this->keys_packed.empty())
+    {
+        return nullptr;
+    }
+
+    return this->chunks[get_slot(chunk_key.pack())];
+}
+
+/**
+ * @brief Checks whether a chunk is located at __chunk_key__.
+ * @since 16-10-2026
+ * @param[in] chunk_key The location of the chunk
+ * @returns True if the map holds the chunk, otherwise returns false
+ */
+bool ChunkMap::contains(const ChunkMapKey &chunk_key) const
+{
+    if (this->keys_packed.empty())
+    {
+        return false;
+    }
+
+    return this->keys_packed[get_slot(chunk_key.pack())] != EMPTY;
+}
+
+/**
+ * @brief Probes the table for __packed__. The table must not be empty.
+ * @since 16-10-2026
+ * @param[in] packed The packed location of the chunk, see ChunkMapKey::pack()
+ * @returns The index of the slot holding __packed__, or of the empty slot where it would be inserted
+ */
+size_t ChunkMap::get_slot(const uint64_t packed) const
+{
+    const size_t mask = this->keys_packed.size() - 1;
+
+    size_t i = hash64(packed) & mask;
+    while (this->keys_packed[i] != packed && this->keys_packed[i] != EMPTY)
+    {
+        i = (i + 1) & mask;
+    }
+
+    return i;
+}
+
+/**
+ * @brief Doubles the size of the table and reinserts every chunk.
+ * @since 16-10-2026
+ */
+void ChunkMap::grow()
+{
+    const size_t new_size = std::max(this->keys_packed.size() * 2, (size_t)64);
+    auto old_keys = std::vector<uint64_t>(new_size, EMPTY);
+    auto old_chunks = std::vector<std::shared_ptr<Chunk>>(new_size);
+    old_keys.swap(this->keys_packed);
+    old_chunks.swap(this->chunks);
+
+    for (size_t i = 0; i < old_keys.size(); ++i)
+    {
+        if (old_keys[i] != EMPTY)
+        {
+            const size_t slot = get_slot(old_keys[i]);
+            this->keys_packed[slot] = old_keys[i];
+            this->chunks[slot] = std::move(old_chunks[i]);
+        }
+    }
+}
@@ -0,0 +1,153 @@
+/**
+ * @file chunk_ring.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief Tracks the disc of chunk columns surrounding the camera.
+ * Whenever the camera crosses into another column, only the columns that entered or left the disc are
+ * reported, so that the cost of streaming is proportional to the amount of chunks that changed.
+ */
+
+#include "chunk_ring.hpp"
+
+/**
+ * @brief Recenters the ring on the camera's column, reporting which columns entered and left it.
+ * The ring matches Camera::is_chunk_in_visible_radius(), i.e. a column is within it if its distance from
+ * the center (in whole chunks) is less than the render distance.
+ * @since 16-10-2026
+ * @param[in] camera A reference to the camera
+ * @param[out] exposed Columns that are now within the ring but weren't previously
+ * @param[out] hidden Columns that were within the ring but no longer are
+ * @returns True if the ring changed, otherwise returns false
+ */
+bool ChunkRing::update(
+    const Camera &camera,
+    std::vector<ChunkColumn> &exposed,
+    std::vector<ChunkColumn> &hidden
+)
+{
+    Settings &settings = Settings::get_instance();
+
+    const auto new_center = ChunkColumn{
+        .x = (int)std::floorf(camera.v_eye.x / KC::CHUNK_SIZE),
+        .y = (int)std::floorf(camera.v_eye.y / KC::CHUNK_SIZE)
+    };
+    const int new_radius = settings.render_distance;
+
+    if (this->center == new_center && this->radius == new_radius)
+    {
+        return false;
+    }
+
+    // Compare the old and new spans of every row that either ring touches
+    int y_min = new_center.y - new_radius;
+    int y_max = new_center.y + new_radius;
+    if (this->center.has_value())
+    {
+        y_min = std::min(y_min, this->center->y - this->radius);
+        y_max = std::max(y_max, this->center->y + this->radius);
+    }
+
+    for (int y = y_min; y <= y_max; ++y)
+    {
+        const auto old_span = get_row_span(this->center, this->radius, y);
+        const auto new_span = get_row_span(new_center, new_radius, y);
+
+        auto within = [](const std::optional<std::pair<int, int>> &span, const int x)
+        {
+            return span.has_value() && x >= span->first && x <= span->second;
+        };
+
+        if (new_span.has_value())
+        {
+            for (int x = new_span->first; x <= new_span->second; ++x)
+            {
+                // Skip over the overlapping section of the row in one step
+                if (within(old_span, x))
+                {
+                    x = old_span->second;
+                    continue;
+                }
+                exposed.push_back(ChunkColumn{ .x = x, .y = y });
+            }
+        }
+
+        if (old_span.has_value())
+        {
+            for (int x = old_span->first; x <= old_span->second; ++x)
+            {
+                if (within(new_span, x))
+                {
+                    x = new_span->second;
+                    continue;
+                }
+                hidden.push_back(ChunkColumn{ .x = x, .y = y });
+            }
+        }
+    }
+
+    this->center = new_center;
+    this->radius = new_radius;
+
+    return true;
+}
+
+/**
+ * @brief Retrieves the column that the ring was centered on during the last update.
+ * @since 16-10-2026
+ * @returns The center column, or std::nullopt if the ring has never been updated
+ */
+std::optional<ChunkColumn> ChunkRing::get_center() const
+{
+    return this->center;
+}
+
+/**
+ * @brief Retrieves the radius of the ring during the last update.
+ * @since 16-10-2026
+ * @returns The radius of the ring (in chunks)
+ */
+int ChunkRing::get_radius() const
+{
+    return this->radius;
+}
+
+/**
+ * @brief Calculates the range of columns which lie within the ring on row __y__.
+ * @since 16-10-2026
+ * @param[in] center The column at the center of the ring
+ * @param[in] radius The radius of the ring (in chunks)
+ * @param[in] y The row being queried
+ * @returns The first and last columns of the row within the ring, or std::nullopt if there are none
+ */
+std::optional<std::pair<int, int>> ChunkRing::get_row_span(
+    const std::optional<ChunkColumn> center,
+    const int radius,
+    const int y
+)
+{
+    if (!center.has_value())
+    {
+        return std::nullopt;
+    }
+
+    const int dy = y - center->y;
+    const int limit = (radius * radius) - (dy * dy);
+    if (limit <= 0)
+    {
+        return std::nullopt;
+    }
+
+    // Largest half-width for which (dx * dx) + (dy * dy) < radius * radius
+    int half_width = (int)std::sqrt((float)limit);
+    while (half_width * half_width >= limit)
+    {
+        --half_width;
+    }
+    while ((half_width + 1) * (half_width + 1) < limit)
+    {
+        ++half_width;
+    }
+
+    return std::make_pair(center->x - half_width, center->x + half_width);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file chunk_scheduler.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief Orders chunk load requests so that the chunks closest to the player, and in front of the camera,
+ * are generated first. Requests for chunks that leave the visible radius are cancelled.
+ */
+
+#include "chunk_scheduler.hpp"
+
+/**
+ * @brief Queues __chunk_location__ to be loaded. Duplicate requests are ignored.
+ * @since 16-10-2026
+ * @param[in] camera A reference to the camera used to prioritize the request
+ * @param[in] chunk_location The location of the chunk to be loaded
+ */
+void ChunkScheduler::push(const Camera &camera, const Vec3_t chunk_location)
+{
+    const auto key = ChunkMapKey(chunk_location);
+    if (!this->pending.insert(key).second)
+    {
+        return;
+    }
+
+    this->heap.push_back(ChunkRequest{ .key = key, .priority = get_priority(camera, key) });
+    std::push_heap(this->heap.begin(), this->heap.end());
+}
+
+/**
+ * @brief Removes the highest priority request that is still within the visible radius.
+ * Requests which have left the visible radius are discarded along the way.
+ * @since 16-10-2026
+ * @param[in] camera A reference to the camera used to test visibility
+ * @returns The location of the chunk to be loaded, or std::nullopt if no requests remain
+ */
+std::optional<Vec3_t> ChunkScheduler::pop(const Camera &camera)
+{
+    while (!this->heap.empty())
+    {
+        std::pop_heap(this->heap.begin(), this->heap.end());
+        const auto key = this->heap.back().key;
+        this->heap.pop_back();
+        this->pending.erase(key);
+
+        auto chunk_location = Vec3_t{ .v = { (float)key.x, (float)key.y, (float)key.z }};
+        if (camera.is_chunk_in_visible_radius(chunk_location))
+        {
+            return chunk_location;
+        }
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief Recomputes the priority of every pending request after the camera has moved or rotated,
+ * cancelling the requests for chunks which are no longer within the visible radius.
+ * @since 16-10-2026
+ * @param[in] camera A reference to the camera used to prioritize the requests
+ */
+void ChunkScheduler::reprioritize(const Camera &camera)
+{
+    std::erase_if(this->heap, [&](const ChunkRequest &request)
+    {
+        const auto &key = request.key;
+        if (camera.is_chunk_in_visible_radius(Vec3_t{ .v = { (float)key.x, (float)key.y, (float)key.z }}))
+        {
+            return false;
+        }
+
+        this->pending.erase(key);
+        return true;
+    });
+
+    for (auto &request : this->heap)
+    {
+        request.priority = get_priority(camera, request.key);
+    }
+    std::make_heap(this->heap.begin(), this->heap.end());
+
+    this->v_look_dir = camera.v_look_dir;
+}
+
+/**
+ * @brief Checks whether the camera has turned far enough since the last reprioritization that the
+ * order of pending requests ought to be recomputed.
+ * @since 16-10-2026
+ * @param[in] camera A reference to the camera
+ * @returns True if the requests should be reprioritized, otherwise returns false
+ */
+bool ChunkScheduler::is_stale(const Camera &camera) const
+{
+    const float cos_theta =
+        (this->v_look_dir.x * camera.v_look_dir.x) +
+        (this->v_look_dir.y * camera.v_look_dir.y) +
+        (this->v_look_dir.z * camera.v_look_dir.z);
+
+    return !this->heap.empty() && cos_theta < KC::REPRIORITIZE_COS_THRESHOLD;
+}
+
+/**
+ * @brief Calculates the priority of the chunk at __key__.
+ * The priority is the distance from the camera to the chunk's center, inflated by up to
+ * KC::VIEW_PRIORITY_WEIGHT for chunks that lie behind the camera.
+ * @since 16-10-2026
+ * @param[in] camera A reference to the camera
+ * @param[in] key The location of the chunk
+ * @returns The priority of the chunk (lower values are loaded first)
+ */
+float ChunkScheduler::get_priority(const Camera &camera, const ChunkMapKey key)
+{
+    // Blocks are centered on integer coordinates, so chunks span key * N - 0.5 to key * N + N - 0.5 (see ChunkBounds)
+    const float half_chunk = (KC::CHUNK_SIZE - 1) / 2.0f;
+    const Vec3_t chunk_center = { .v = {
+        (key.x * (float)KC::CHUNK_SIZE) + half_chunk,
+        (key.y * (float)KC::CHUNK_SIZE) + half_chunk,
+        (key.z * (float)KC::CHUNK_SIZE) + half_chunk
+    }};
+
+    const Vec3_t v_to_chunk = qm_v3_sub(chunk_center, camera.v_eye);
+    const float distance = std::sqrt(
+        (v_to_chunk.x * v_to_chunk.x) +
+        (v_to_chunk.y * v_to_chunk.y) +
+        (v_to_chunk.z * v_to_chunk.z)
+    );
+    if (distance < KC::CHUNK_SIZE)
+    {
+        // Always load the chunks surrounding the player first, regardless of direction
+        return distance;
+    }
+
+    const float cos_theta = (
+        (v_to_chunk.x * camera.v_look_dir.x) +
+        (v_to_chunk.y * camera.v_look_dir.y) +
+        (v_to_chunk.z * camera.v_look_dir.z)
+    ) / distance;
+    return distance * (1.0f + (KC::VIEW_PRIORITY_WEIGHT * (1.0f - cos_theta) * 0.5f));
+}
@@ -0,0 +1,107 @@
+/**
+ * @file frustum.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief The camera's view frustum, as six planes extracted from the combined projection and view matrix.
+ * Used to skip drawing chunks that lie entirely outside of the camera's view.
+ */
+
+#include "frustum.hpp"
+
+/**
+ * @brief Default constructor for Frustum. Every point lies inside of the default frustum.
+ * @since 16-10-2026
+ */
+Frustum::Frustum()
+{
+    this->planes.fill(Vec4_t{ .v = { 0.0f, 0.0f, 0.0f, 1.0f }});
+}
+
+/**
+ * @brief Extracts the frustum's planes from __m_view_proj__ (Gribb-Hartmann).
+ * A point is within the frustum if its clip-space coordinates satisfy -w <= x, y, z <= w, and each of
+ * these inequalities is a plane formed by adding or subtracting a row of the matrix from its last row.
+ * @since 16-10-2026
+ * @param[in] m_view_proj The projection matrix multiplied by the view matrix (row-major)
+ */
+Frustum::Frustum(const Mat4_t &m_view_proj)
+{
+    const auto &m = m_view_proj.m;
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        for (const float sign : { 1.0f, -1.0f })
+        {
+            Vec4_t &plane = this->planes[(axis * 2) + ((sign > 0.0f) ? 0 : 1)];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                plane.v[i] = m[3][i] + (sign * m[axis][i]);
+            }
+
+            // Normalize, so that the planes' distances are comparable
+            const float len = std::sqrt((plane.x * plane.x) + (plane.y * plane.y) + (plane.z * plane.z));
+            if (len > 0.0f)
+            {
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    plane.v[i] /= len;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Checks whether the box spanning __box_min__ to __box_max__ lies at least partially within the frustum.
+ * Conservative: boxes near the frustum's corners may be reported as visible even though they aren't.
+ * @since 16-10-2026
+ * @param[in] box_min The lowest corner of the box
+ * @param[in] box_max The highest corner of the box
+ * @returns True if the box may be visible, otherwise returns false
+ */
+bool Frustum::intersects_box(const Vec3_t box_min, const Vec3_t box_max) const
+{
+    for (const auto &plane : this->planes)
+    {
+        // The corner of the box furthest along the plane's normal
+        const float x = (plane.x >= 0.0f) ? box_max.x : box_min.x;
+        const float y = (plane.y >= 0.0f) ? box_max.y : box_min.y;
+        const float z = (plane.z >= 0.0f) ? box_max.z : box_min.z;
+
+        if ((plane.x * x) + (plane.y * y) + (plane.z * z) + plane.w < 0.0f)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Tests every bounding box of __bounds__ against the frustum, see Frustum::intersects_box().
+ * The boxes are swept once per plane. Since the corner to test against a plane only depends on the plane,
+ * each sweep is a branchless multiply-add over contiguous arrays, which the compiler vectorizes.
+ * @since 16-10-2026
+ * @param[in] bounds The bounding boxes
+ * @param[out] is_visible Set to 1 for each box that may be visible, and 0 otherwise
+ */
+void Frustum::cull(const ChunkBounds &bounds, std::vector<uint8_t> &is_visible) const
+{
+    const size_t count = bounds.size();
+    is_visible.assign(count, 1);
+    uint8_t *visible = is_visible.data();
+
+    for (const auto &plane : this->planes)
+    {
+        const float *xs = (plane.x >= 0.0f) ? bounds.max_x.data() : bounds.min_x.data();
+        const float *ys = (plane.y >= 0.0f) ? bounds.max_y.data() : bounds.min_y.data();
+        const float *zs = (plane.z >= 0.0f) ? bounds.max_z.data() : bounds.min_z.data();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float distance = (plane.x * xs[i]) + (plane.y * ys[i]) + (plane.z * zs[i]) + plane.w;
+            visible[i] &= (uint8_t)(distance >= 0.0f);
+        }
+    }
+}
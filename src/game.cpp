@@ -11,6 +11,10 @@
 uint64_t key_mask = 0;
 static bool query_pointer_location = true;
 static std::atomic<unsigned> fps = std::atomic<unsigned>(0);
+static std::atomic<size_t> drawn_vertices = std::atomic<size_t>(0);  // Vertices submitted on the last frame
+static std::atomic<size_t> meshed_vertices = std::atomic<size_t>(0); // Vertices of every loaded chunk on the last frame
+static std::atomic<size_t> culled_chunks = std::atomic<size_t>(0);   // Chunks removed by occlusion culling on the last frame
+static std::atomic<size_t> tested_chunks = std::atomic<size_t>(0);   // Chunks within the frustum on the last frame
 static float delta_time_ms;
 
 static void fps_callback()
@@ -19,7 +23,13 @@ static void fps_callback()
     while (settings.is_running)
     {
         std::this_thread::sleep_for(std::chrono::seconds(1));
-        std::cout << "FPS: " << fps.exchange(0) << std::endl;
+        std::cout
+            << "FPS: " << fps.exchange(0)
+            << " | Vertices drawn: " << drawn_vertices.load()
+            << " of " << meshed_vertices.load()
+            << " | Chunks occluded: " << culled_chunks.load()
+            << " of " << tested_chunks.load()
+            << std::endl;
     }
 }
 
@@ -121,8 +131,9 @@ Game::Game()
 
     /*** Create shader program(s) ***/
 
-    this->block_shader  = Shader("res/shader/block.vs", "res/shader/block.fs");
-    this->skybox_shader = Shader("res/shader/skybox.vs", "res/shader/skybox.fs");
+    this->block_shader        = Shader("res/shader/block.vs", "res/shader/block.fs");
+    this->alpha_tested_shader = Shader("res/shader/block.vs", "res/shader/block_alpha_tested.fs");
+    this->skybox_shader       = Shader("res/shader/skybox.vs", "res/shader/skybox.fs");
 
     /*** Create texture atlas ***/
 
@@ -153,7 +164,8 @@ Game::Game()
     Camera camera;
     Mvp mvp = Mvp(camera);
     ChunkManager &chunk_mgr = ChunkManager::get_instance();
-    std::queue<ChunkMapKey> chunk_queue;
+    ChunkScheduler chunk_scheduler;
+    ChunkRing chunk_ring;
 
     while (settings.is_running)
     {
@@ -161,7 +173,7 @@ Game::Game()
 
         process_events(camera);
         camera.calculate_view_matrix();
-        generate_terrain(camera, chunk_queue);
+        generate_terrain(camera, chunk_scheduler, chunk_ring);
         apply_physics(camera);
         chunk_mgr.bind_terrain_mesh();
         render_frame(camera, mvp, skybox);
@@ -191,6 +203,8 @@ Game::Game()
  */
 void Game::cleanup()
 {
+    // The worker pool outlives the Game, so it must be stopped while the singletons its tasks use still exist
+    ChunkManager::get_instance().stop_workers();
     this->fps_thread.join();
 
     /*** ImGui window ***/
@@ -234,94 +248,86 @@ void Game::cleanup()
  * @brief Generates terrain according to the specified render distance.
  * TODO: params
  */
-void Game::generate_terrain(Camera &camera, std::queue<ChunkMapKey> &chunk_queue)
+void Game::generate_terrain(Camera &camera, ChunkScheduler &chunk_scheduler, ChunkRing &chunk_ring)
 {
-    Settings &settings = Settings::get_instance();
     ChunkManager &chunk_mgr = ChunkManager::get_instance();
-    ChunkFactory &chunk_factory = ChunkFactory::get_instance();
-
-    float duration_ms;
-    const float tgt_fps_ms = (float)KC::SEC_AS_MS.count() / settings.tgt_fps;
-
-    auto start = std::chrono::high_resolution_clock::now();
 
-    // 1. Obtain visible chunk area
-    Vec2_t top_left = { .v = {
-        floorf(camera.v_eye.x / KC::CHUNK_SIZE) - settings.render_distance,
-        floorf(camera.v_eye.y / KC::CHUNK_SIZE) - settings.render_distance
-    }};
-    Vec2_t btm_right = { .v = {
-        floorf(camera.v_eye.x / KC::CHUNK_SIZE) + settings.render_distance,
-        floorf(camera.v_eye.y / KC::CHUNK_SIZE) + settings.render_distance
-    }};
+    // 1. Find the columns that entered or left the visible radius since the camera last changed columns
+    auto exposed = std::vector<ChunkColumn>{};
+    auto hidden = std::vector<ChunkColumn>{};
+    const bool ring_changed = chunk_ring.update(camera, exposed, hidden);
 
     // 2. Unload chunks that are no longer visible
-    std::erase_if(chunk_mgr.GCL.map, [&](const auto &kv_pair)
+    for (const auto &column : hidden)
     {
-        const auto &chunk = kv_pair.second;
-
-        // Can't unload if chunk contains folliage for another chunk that hasn't been unloaded yet
-        if (!chunk->tree_ref.expired())
+        const auto [z_min, z_max] = chunk_mgr.get_column_z_range(column);
+        for (int z = z_min; z <= z_max; ++z)
         {
-            return false;
+            chunk_mgr.unload_chunk(Vec3_t{ .v = { (float)column.x, (float)column.y, (float)z }});
         }
+    }
 
-        return !camera.is_chunk_in_visible_radius(chunk->location);
-    });
-
-    // TODO:
-    // 3. Optional (but recommended): Sort chunk positions by distance relative to player
-
-    // TODO: Gather z coordinate based on biome (min, max) chunk height
-    // 4. Queue new chunks that need to be loaded
-    for (int z = 8; z <= 10; ++z)
+    // 3. Queue new chunks that need to be loaded, nearest (and in view) first
+    for (const auto &column : exposed)
     {
-        for (int y = top_left.y; y < btm_right.y; ++y)
+        const auto [z_min, z_max] = chunk_mgr.get_column_z_range(column);
+        for (int z = z_min; z <= z_max; ++z)
         {
-            for (int x = top_left.x; x < btm_right.x; ++x)
+            auto chunk_location = Vec3_t{ .v = { (float)column.x, (float)column.y, (float)z }};
+            if (!chunk_mgr.GCL.contains(chunk_location) && !chunk_mgr.is_chunk_queued(chunk_location))
             {
-                chunk_queue.push(ChunkMapKey((Vec3_t){ .v = { (float)x, (float)y, (float)z }}));
+                chunk_scheduler.push(camera, chunk_location);
             }
         }
     }
 
-    // 5. Generate as many chunks as possible given target FPS (minimum one chunk)
-    do
+    // 4. Reorder pending chunks if the camera has moved or turned, cancelling those that left the radius
+    if (ring_changed || chunk_scheduler.is_stale(camera))
     {
-        if (chunk_queue.empty())
+        chunk_scheduler.reprioritize(camera);
+    }
+
+    // Heightmaps and pending structure blocks are kept for one column beyond the ring, since the ring's
+    // chunks need them for their borders and their trees may overhang it
+    if (ring_changed)
+    {
+        HeightmapCache::get_instance().evict_outside(*chunk_ring.get_center(), chunk_ring.get_radius() + 2);
+        chunk_mgr.pending_writes.evict_outside(*chunk_ring.get_center(), chunk_ring.get_radius() + 2);
+    }
+
+    // 5. Hand queued chunks to the worker pool, keeping just enough in flight to keep every worker busy
+    while (chunk_mgr.get_queued_count() < chunk_mgr.get_queue_capacity())
+    {
+        auto chunk_location = chunk_scheduler.pop(camera);
+        if (!chunk_location.has_value())
         {
             break;
         }
 
-        auto next = chunk_queue.front();
-        chunk_queue.pop();
-        auto chunk_location = Vec3_t{ .v = { (float)next.x, (float)next.y, (float)next.z }};
-
-        // Only process chunks that are still within visible radius and don't already exist in the GCL
-        if (camera.is_chunk_in_visible_radius(chunk_location) && !chunk_mgr.GCL.contains(chunk_location))
+        if (!chunk_mgr.GCL.contains(*chunk_location) && !chunk_mgr.is_chunk_queued(*chunk_location))
         {
-            auto deferred_chunks = ChunkMap{};
-            auto chunk = chunk_factory.make_chunk(chunk_location);
-            deferred_chunks.insert(chunk);
+            chunk_mgr.queue_chunk(*chunk_location);
+        }
+    }
 
-            // Plant trees
-            if (chunk->location.z > ((float)KC::SEA_LEVEL / KC::CHUNK_SIZE))
-            {
-                auto deferred = chunk_mgr.plant_trees(chunk);
-                deferred_chunks.insert(deferred.begin(), deferred.end());
-            }
+    // 6. Insert chunks that the workers have finished generating. Any slices that change as a result are
+    // remeshed once the frame's terrain updates are complete, see ChunkManager::bind_terrain_mesh()
+    for (auto &generated : chunk_mgr.take_generated_chunks())
+    {
+        auto &chunk = generated.chunk;
 
-            for (const auto &deferred : deferred_chunks.values())
+        // The chunk may have gone out of range in the meantime. Edited chunks are kept for when it returns
+        if (!camera.is_chunk_in_visible_radius(chunk->location) || chunk_mgr.GCL.contains(chunk->location))
+        {
+            if (chunk->is_edited && !chunk_mgr.GCL.contains(chunk->location))
             {
-                deferred->update_mesh();
+                chunk_mgr.chunk_cache.insert(chunk);
             }
-            chunk_mgr.GCL.insert(chunk);
+            continue;
         }
 
-        auto end = std::chrono::high_resolution_clock::now();
-        duration_ms = std::chrono::duration<float, std::milli>(end - start).count();
+        chunk_mgr.insert_generated_chunk(generated);
     }
-    while (duration_ms < tgt_fps_ms);
 }
 
 struct AABB
@@ -339,18 +345,18 @@ static AABB make_player_aabb(const Vec3_t v_eye)
     };
 }
 
-static AABB make_block_aabb(const Block &block)
+static AABB make_block_aabb(const Vec3_t world_location)
 {
     return {
         .min = { .v = {
-            block.bottom_face.front().pos.x,
-            block.bottom_face.front().pos.y,
-            block.bottom_face.front().pos.z
+            world_location.x - 0.5f,
+            world_location.y - 0.5f,
+            world_location.z - 0.5f
         }},
         .max = { .v = {
-            block.back_face.front().pos.x,
-            block.back_face.front().pos.y,
-            block.back_face.front().pos.z,
+            world_location.x + 0.5f,
+            world_location.y + 0.5f,
+            world_location.z + 0.5f
         }}
     };
 }
@@ -368,7 +374,6 @@ static void resolve_axis(
     std::shared_ptr<Chunk> chunk
 )
 {
-    ChunkManager &chunk_mgr = ChunkManager::get_instance();
     Player &player = Player::get_instance();
 
     const float padding = 0.0001f;
@@ -397,31 +402,20 @@ static void resolve_axis(
         {
             for (int x = min_x; x < max_x; ++x)
             {
-                // Get proper coordinates since they might be outside current chunk
-                Vec3_t actual_chunk{};
-                Vec3_t actual_block{};
-
-                actual_chunk.x = std::floorf(((chunk->location.x * KC::CHUNK_SIZE) + x) / KC::CHUNK_SIZE);
-                actual_chunk.y = std::floorf(((chunk->location.y * KC::CHUNK_SIZE) + y) / KC::CHUNK_SIZE);
-                actual_chunk.z = std::floorf(((chunk->location.z * KC::CHUNK_SIZE) + z) / KC::CHUNK_SIZE);
-
-                actual_block.x = (((int)x % KC::CHUNK_SIZE) + KC::CHUNK_SIZE) % KC::CHUNK_SIZE;
-                actual_block.y = (((int)y % KC::CHUNK_SIZE) + KC::CHUNK_SIZE) % KC::CHUNK_SIZE;
-                actual_block.z = (((int)z % KC::CHUNK_SIZE) + KC::CHUNK_SIZE) % KC::CHUNK_SIZE;
-
-                auto chunk = chunk_mgr.GCL.find(actual_chunk);
-                if (chunk == nullptr)
+                // The block may lie within a neighboring chunk
+                const auto block = chunk->get_block_relative(x, y, z);
+                if (!block.has_value() || block->type == BlockType::AIR)
                 {
                     continue;
                 }
 
-                const Block &block = chunk->blocks[actual_block.z][actual_block.y][actual_block.x];
-                if (block.type == BlockType::AIR)
-                {
-                    continue;
-                }
+                const Vec3_t block_world_location = { .v = {
+                    chunk_world_location.x + x,
+                    chunk_world_location.y + y,
+                    chunk_world_location.z + z
+                }};
 
-                AABB block_box = make_block_aabb(block);
+                AABB block_box = make_block_aabb(block_world_location);
                 if (!are_bodies_collided(player_box, block_box))
                 {
                     continue;
@@ -548,6 +542,7 @@ void Game::apply_physics(Camera &camera)
 void Game::process_events(Camera &camera)
 {
     Settings &settings = Settings::get_instance();
+    ChunkManager &chunk_mgr = ChunkManager::get_instance();
     Player &player = Player::get_instance();
 
     while (XPending(kc_win.dpy) > 0)
@@ -600,6 +595,12 @@ void Game::process_events(Camera &camera)
                 {
                     settings.is_running = false;
                 }
+
+                // Toggles should only fire once per key press
+                if (key_binds.contains(sym) && key_binds.at(sym) == KeyAction::TOGGLE_MESHER)
+                {
+                    settings.greedy_meshing = !settings.greedy_meshing;
+                }
                 break;
             }
             // Key was released
@@ -620,7 +621,22 @@ void Game::process_events(Camera &camera)
             // Mouse button was released
             case ButtonRelease:
             {
-                camera.cast_ray();
+                // Left click breaks the block being looked at, and right click places one against it
+                const auto hit = camera.cast_ray();
+                if (!hit.has_value())
+                {
+                    break;
+                }
+
+                if (kc_win.xev.xbutton.button == Button1)
+                {
+                    chunk_mgr.edit_block(hit->block_location, BlockType::AIR);
+                }
+                else if (kc_win.xev.xbutton.button == Button3 &&
+                         !are_bodies_collided(make_player_aabb(camera.v_eye), make_block_aabb(hit->adjacent_location)))
+                {
+                    chunk_mgr.edit_block(hit->adjacent_location, player.held_block);
+                }
                 break;
             }
             default:
@@ -630,6 +646,18 @@ void Game::process_events(Camera &camera)
         }
     }
 
+    // Regenerate every chunk's mesh if the meshing mode was switched at runtime
+    static bool greedy_meshing = settings.greedy_meshing;
+    if (greedy_meshing != settings.greedy_meshing)
+    {
+        greedy_meshing = settings.greedy_meshing;
+        for (auto &chunk : chunk_mgr.GCL.values())
+        {
+            chunk->update_mesh(greedy_meshing);
+        }
+        chunk_mgr.mark_chunks_dirty(chunk_mgr.GCL);
+    }
+
     player.update_plyr_movement(camera);
 }
 
@@ -642,24 +670,13 @@ void Game::render_frame(Camera &camera, Mvp &mvp, SkyBox &skybox)
     Settings &settings = Settings::get_instance();
     ChunkManager &chunk_mgr = ChunkManager::get_instance();
 
-    unsigned u_model, u_view, u_proj;
+    unsigned u_model, u_view, u_proj, u_chunk_origin;
 
     glClearColor(1.0f, 1.0, 1.0f, 1.0);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     /*** Render terrain ***/
 
-    block_shader.bind();
-
-    // Model
-    mvp.m_model = qm_m4_ident;
-    u_model = glGetUniformLocation(block_shader.id, "model");
-    glUniformMatrix4fv(u_model, 1, GL_TRUE, (float*)mvp.m_model.m);
-
-    // View
-    u_view = glGetUniformLocation(block_shader.id, "view");
-    glUniformMatrix4fv(u_view, 1, GL_TRUE, (float*)mvp.m_view->m);
-
     // Projection
     mvp.m_proj = qm_m4_projection(
         settings.aspect,
@@ -667,15 +684,74 @@ void Game::render_frame(Camera &camera, Mvp &mvp, SkyBox &skybox)
         settings.znear,
         settings.zfar
     );
-    u_proj = glGetUniformLocation(block_shader.id, "proj");
-    glUniformMatrix4fv(u_proj, 1, GL_TRUE, (float*)mvp.m_proj.m);
 
-    // Issue draw call
-    glBindVertexArray(chunk_mgr.terrain_mesh.vao);
-    glDrawArrays(GL_TRIANGLES, 0, chunk_mgr.terrain_mesh.vertices.size());
-    glBindVertexArray(0);
+    // Skip chunks outside of the view frustum, or hidden from the camera
+    auto draw_list = std::vector<Chunk*>{};
+    const Mat4_t m_view_proj = qm_m4_mul(mvp.m_proj, *mvp.m_view);
+    chunk_mgr.get_draw_list(Frustum(m_view_proj), m_view_proj, camera.v_eye, draw_list);
+
+    size_t n_meshed = 0;
+    size_t n_drawn = 0;
+    for (const auto &chunk : chunk_mgr.GCL.values())
+    {
+        n_meshed += chunk->mesh_range.has_value() ? chunk->mesh_range->count : 0;
+    }
+
+    // Issue one draw call per chunk and render pass, since vertex positions are relative to the chunk's
+    // origin. Only the ranges of each mesh whose faces may point towards the camera are submitted
+    auto firsts = std::vector<GLint>{};
+    auto counts = std::vector<GLsizei>{};
+    auto draw_terrain = [&](const Shader &shader, const RenderPass pass, const std::vector<Chunk*> &chunks)
+    {
+        shader.bind();
+
+        // Model
+        mvp.m_model = qm_m4_ident;
+        u_model = glGetUniformLocation(shader.id, "model");
+        glUniformMatrix4fv(u_model, 1, GL_TRUE, (float*)mvp.m_model.m);
+
+        // View
+        u_view = glGetUniformLocation(shader.id, "view");
+        glUniformMatrix4fv(u_view, 1, GL_TRUE, (float*)mvp.m_view->m);
+
+        // Projection
+        u_proj = glGetUniformLocation(shader.id, "proj");
+        glUniformMatrix4fv(u_proj, 1, GL_TRUE, (float*)mvp.m_proj.m);
+
+        u_chunk_origin = glGetUniformLocation(shader.id, "chunk_origin");
+        glBindVertexArray(chunk_mgr.terrain_arena.vao);
+        for (const Chunk *chunk : chunks)
+        {
+            firsts.clear();
+            counts.clear();
+            chunk->get_facing_ranges(pass, camera.v_eye, firsts, counts);
+            if (firsts.empty())
+            {
+                continue;
+            }
+
+            glUniform3f(
+                u_chunk_origin,
+                chunk->location.x * KC::CHUNK_SIZE,
+                chunk->location.y * KC::CHUNK_SIZE,
+                chunk->location.z * KC::CHUNK_SIZE
+            );
+            glMultiDrawArrays(GL_TRIANGLES, firsts.data(), counts.data(), firsts.size());
 
-    block_shader.unbind();
+            for (const GLsizei count : counts)
+            {
+                n_drawn += count;
+            }
+        }
+        glBindVertexArray(0);
+
+        shader.unbind();
+    };
+
+    // Opaque faces are drawn first, with a shader that never discards fragments so that early depth testing
+    // stays enabled. Only the alpha-tested faces (e.g. leaves) pay for discarding transparent texels
+    draw_terrain(block_shader, RenderPass::OPAQUE, draw_list);
+    draw_terrain(alpha_tested_shader, RenderPass::ALPHA_TESTED, draw_list);
 
     /*** Render skybox ***/
 
@@ -707,6 +783,42 @@ void Game::render_frame(Camera &camera, Mvp &mvp, SkyBox &skybox)
     glDepthMask(GL_TRUE);
     glDepthFunc(GL_LESS);
 
+    /*** Render translucent terrain ***/
+
+    // Translucent faces (e.g. water) are blended over everything behind them, including the skybox. They are
+    // drawn last without writing depth, and their chunks are sorted back to front
+    auto translucent_list = std::vector<Chunk*>{};
+    std::copy_if(draw_list.begin(), draw_list.end(), std::back_inserter(translucent_list), [](const Chunk *chunk)
+    {
+        return chunk->has_faces(RenderPass::TRANSLUCENT);
+    });
+
+    auto get_distance = [&](const Chunk *chunk)
+    {
+        constexpr float half_size = (KC::CHUNK_SIZE / 2.0f) - 0.5f;
+        const Vec3_t center = qm_v3_add(
+            qm_v3_scale(chunk->location, KC::CHUNK_SIZE),
+            Vec3_t{ .v = { half_size, half_size, half_size }}
+        );
+        return qm_v3_len(qm_v3_sub(center, camera.v_eye));
+    };
+    std::sort(translucent_list.begin(), translucent_list.end(), [&](const Chunk *lhs, const Chunk *rhs)
+    {
+        return get_distance(lhs) > get_distance(rhs);
+    });
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDepthMask(GL_FALSE);
+    draw_terrain(block_shader, RenderPass::TRANSLUCENT, translucent_list);
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+
+    drawn_vertices = n_drawn;
+    meshed_vertices = n_meshed;
+    culled_chunks = chunk_mgr.culling_stats.occlusion_culled;
+    tested_chunks = chunk_mgr.culling_stats.chunks - chunk_mgr.culling_stats.frustum_culled;
+
     // Blit
     glFlush();
 
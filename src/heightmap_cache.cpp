@@ -0,0 +1,112 @@
+/**
+ * @file heightmap_cache.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief Singleton class which caches the terrain heightmap of each chunk column.
+ * Every chunk stacked within a column shares the column's heightmap, and the one block border that
+ * a chunk needs around its heightmap is read from the neighboring columns, so each column's noise
+ * is only ever sampled once whilst it remains loaded.
+ */
+
+#include "heightmap_cache.hpp"
+
+/**
+ * @brief Entry point for accessing the singleton's instance.
+ * @since 16-10-2026
+ * @returns A reference to the single HeightmapCache instance
+ */
+HeightmapCache &HeightmapCache::get_instance()
+{
+    static HeightmapCache heightmap_cache;
+    return heightmap_cache;
+}
+
+/**
+ * @brief Retrieves the heightmap of __column__, sampling it if it isn't already cached.
+ * Safe to call from multiple threads.
+ * @since 16-10-2026
+ * @param[in] column The chunk column
+ * @returns The heightmap of __column__
+ */
+std::shared_ptr<const Heightmap> HeightmapCache::get(const ChunkColumn column)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->heightmaps_mutex);
+        auto needle = this->heightmaps.find(column);
+        if (needle != this->heightmaps.end())
+        {
+            return needle->second;
+        }
+    }
+
+    // Sample outside of the lock so that other workers aren't held up
+    std::array<float, KC::CHUNK_SIZE * KC::CHUNK_SIZE> samples;
+    sample_biome_heights(
+        Vec2_t{ .v = {
+            (float)column.x * KC::CHUNK_SIZE,
+            (float)column.y * KC::CHUNK_SIZE
+        }},
+        KC::CHUNK_SIZE,
+        KC::CHUNK_SIZE,
+        samples.data()
+    );
+
+    auto heightmap = std::make_shared<Heightmap>();
+    std::copy(samples.begin(), samples.end(), heightmap->heights.begin());
+
+    // Another worker may have sampled the same column in the meantime, in which case theirs is kept
+    std::lock_guard<std::mutex> lock(this->heightmaps_mutex);
+    return this->heightmaps.try_emplace(column, heightmap).first->second;
+}
+
+/**
+ * @brief Fills __block_heights__ with the heightmap of __column__ surrounded by a one block border taken
+ * from the neighboring columns, i.e. a (KC::CHUNK_SIZE + 2) squared grid indexed as [y + 1][x + 1].
+ * @since 16-10-2026
+ * @param[in] column The chunk column
+ * @param[out] block_heights The bordered heightmap
+ */
+void HeightmapCache::get_bordered(const ChunkColumn column, std::vector<std::vector<uint8_t>> &block_heights)
+{
+    std::array<std::shared_ptr<const Heightmap>, 9> neighbors;
+    for (int dy = -1; dy <= 1; ++dy)
+    {
+        for (int dx = -1; dx <= 1; ++dx)
+        {
+            neighbors[((dy + 1) * 3) + (dx + 1)] = get(ChunkColumn{ .x = column.x + dx, .y = column.y + dy });
+        }
+    }
+
+    const int size = KC::CHUNK_SIZE;
+    for (int y = -1; y <= size; ++y)
+    {
+        for (int x = -1; x <= size; ++x)
+        {
+            // Select the column that the block belongs to, and its location within that column
+            const int nx = (x < 0) ? 0 : (x < size) ? 1 : 2;
+            const int ny = (y < 0) ? 0 : (y < size) ? 1 : 2;
+            const int local_x = (x + size) % size;
+            const int local_y = (y + size) % size;
+
+            block_heights[y + 1][x + 1] = neighbors[(ny * 3) + nx]->heights[(local_y * size) + local_x];
+        }
+    }
+}
+
+/**
+ * @brief Evicts the heightmaps of every column that lies at least __radius__ chunks from __center__.
+ * @since 16-10-2026
+ * @param[in] center The column at the center of the loaded area
+ * @param[in] radius The distance (in chunks) beyond which heightmaps are evicted
+ */
+void HeightmapCache::evict_outside(const ChunkColumn center, const int radius)
+{
+    std::lock_guard<std::mutex> lock(this->heightmaps_mutex);
+    std::erase_if(this->heightmaps, [&](const auto &kv_pair)
+    {
+        const int dx = kv_pair.first.x - center.x;
+        const int dy = kv_pair.first.y - center.y;
+        return ((dx * dx) + (dy * dy)) >= (radius * radius);
+    });
+}
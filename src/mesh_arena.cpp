@@ -0,0 +1,201 @@
+/**
+ * @file mesh_arena.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief A single GPU vertex buffer that is sub-allocated into per-chunk ranges.
+ * Chunks only upload their own range when their mesh changes, rather than the whole world being
+ * re-uploaded. Freed ranges are coalesced with their neighbours and reused by later allocations.
+ */
+
+#include "mesh_arena.hpp"
+
+/**
+ * @brief Constructor for MeshArena class.
+ * @since 16-10-2026
+ * @param[in] capacity The initial size of the vertex buffer (in vertices)
+ */
+MeshArena::MeshArena(const size_t capacity) :
+    capacity(capacity)
+{
+    glGenVertexArrays(1, &this->vao);
+    glBindVertexArray(this->vao);
+
+    glGenBuffers(1, &this->vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
+    glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(TerrainVertex), nullptr, GL_DYNAMIC_DRAW);
+
+    // Packed vertex attribute (decoded by the vertex shader)
+    glVertexAttribIPointer(0, 1, GL_UNSIGNED_INT, sizeof(TerrainVertex), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    this->free_ranges[0] = capacity;
+}
+
+/**
+ * @brief Default destructor for MeshArena class.
+ * @since 16-10-2026
+ */
+MeshArena::~MeshArena()
+{
+    if (glIsBuffer(this->vbo))
+    {
+        glDeleteBuffers(1, &this->vbo);
+    }
+    if (glIsVertexArray(this->vao))
+    {
+        glDeleteVertexArrays(1, &this->vao);
+    }
+}
+
+/**
+ * @brief Uploads __vertices__ to the arena, reusing __range__ if it is large enough.
+ * If it isn't, __range__ is released and a new range is allocated in its place.
+ * @since 16-10-2026
+ * @param[in,out] range The range currently owned by the mesh (if any)
+ * @param[in] vertices The vertices to upload
+ */
+void MeshArena::upload(std::optional<MeshRange> &range, const std::vector<TerrainVertex> &vertices)
+{
+    if (vertices.empty())
+    {
+        release(range);
+        return;
+    }
+
+    if (!range.has_value() || range->capacity < vertices.size())
+    {
+        release(range);
+        range = allocate(vertices.size());
+    }
+    range->count = vertices.size();
+
+    glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
+    glBufferSubData(
+        GL_ARRAY_BUFFER,
+        range->offset * sizeof(TerrainVertex),
+        vertices.size() * sizeof(TerrainVertex),
+        vertices.data()
+    );
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+/**
+ * @brief Returns __range__ to the arena so that it may be reused.
+ * @since 16-10-2026
+ * @param[in,out] range The range being released. Set to std::nullopt afterwards
+ */
+void MeshArena::release(std::optional<MeshRange> &range)
+{
+    if (!range.has_value())
+    {
+        return;
+    }
+
+    size_t offset = range->offset;
+    size_t count = range->capacity;
+    range = std::nullopt;
+
+    // Coalesce with the following free range
+    auto next = this->free_ranges.find(offset + count);
+    if (next != this->free_ranges.end())
+    {
+        count += next->second;
+        this->free_ranges.erase(next);
+    }
+
+    // Coalesce with the preceding free range
+    auto prev = this->free_ranges.lower_bound(offset);
+    if (prev != this->free_ranges.begin())
+    {
+        --prev;
+        if (prev->first + prev->second == offset)
+        {
+            offset = prev->first;
+            count += prev->second;
+        }
+    }
+
+    this->free_ranges[offset] = count;
+}
+
+/**
+ * @brief Allocates a range of __count__ vertices using a first-fit search, growing the arena if necessary.
+ * @since 16-10-2026
+ * @param[in] count The amount of vertices required
+ * @returns The newly allocated range
+ */
+MeshRange MeshArena::allocate(const size_t count)
+{
+    auto fit = std::find_if(
+        this->free_ranges.begin(),
+        this->free_ranges.end(),
+        [count](const auto &free_range)
+        {
+            return free_range.second >= count;
+        }
+    );
+
+    if (fit == this->free_ranges.end())
+    {
+        grow(this->capacity + count);
+        return allocate(count);
+    }
+
+    const size_t offset = fit->first;
+    const size_t remaining = fit->second - count;
+    this->free_ranges.erase(fit);
+    if (remaining > 0)
+    {
+        this->free_ranges[offset + count] = remaining;
+    }
+
+    return MeshRange{ .offset = offset, .count = 0, .capacity = count };
+}
+
+/**
+ * @brief Reallocates the vertex buffer with at least __min_capacity__ vertices, preserving its contents.
+ * @since 16-10-2026
+ * @param[in] min_capacity The minimum size of the new vertex buffer (in vertices)
+ */
+void MeshArena::grow(const size_t min_capacity)
+{
+    const size_t new_capacity = std::max(this->capacity * 2, min_capacity);
+
+    ID new_vbo;
+    glGenBuffers(1, &new_vbo);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, new_vbo);
+    glBufferData(GL_COPY_WRITE_BUFFER, new_capacity * sizeof(TerrainVertex), nullptr, GL_DYNAMIC_DRAW);
+
+    glBindBuffer(GL_COPY_READ_BUFFER, this->vbo);
+    glCopyBufferSubData(
+        GL_COPY_READ_BUFFER,
+        GL_COPY_WRITE_BUFFER,
+        0, 0,
+        this->capacity * sizeof(TerrainVertex)
+    );
+
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    glDeleteBuffers(1, &this->vbo);
+    this->vbo = new_vbo;
+
+    // Point the vertex attribute at the new buffer
+    glBindVertexArray(this->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
+    glVertexAttribIPointer(0, 1, GL_UNSIGNED_INT, sizeof(TerrainVertex), (void*)0);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Extend the trailing free range (if any) to the end of the new buffer
+    std::optional<MeshRange> tail = MeshRange{
+        .offset = this->capacity,
+        .count = 0,
+        .capacity = new_capacity - this->capacity
+    };
+    this->capacity = new_capacity;
+    release(tail);
+}
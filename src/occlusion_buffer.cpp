@@ -0,0 +1,273 @@
+/**
+ * @file occlusion_buffer.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief A low resolution depth buffer that solid terrain is rasterized into on the CPU each frame, so that
+ * chunks hidden behind hills can be skipped before they are submitted to the GPU.
+ * Occluders are rasterized by sampling pixel centers, while queries cover every pixel a box touches plus a
+ * one pixel margin and compare against the box's nearest corner, so a chunk is only reported as hidden if
+ * occluders lie strictly in front of all of it. Everything is done in plain floating point without any
+ * state carried between frames, so the result for a given frame is deterministic.
+ */
+
+#include "occlusion_buffer.hpp"
+
+/**
+ * @brief Constructor for OcclusionBuffer.
+ * @since 16-10-2026
+ * @param[in] width The width of the buffer (in pixels)
+ * @param[in] height The height of the buffer (in pixels)
+ */
+OcclusionBuffer::OcclusionBuffer(const size_t width, const size_t height) :
+    width(width),
+    height(height),
+    depths(width * height, std::numeric_limits<float>::max()),
+    m_view_proj(qm_m4_ident),
+    znear(0.0f)
+{}
+
+/**
+ * @brief Empties the buffer and sets up the camera that occluders and queries are projected with.
+ * @since 16-10-2026
+ * @param[in] m_view_proj The projection matrix multiplied by the view matrix (row-major)
+ * @param[in] znear The distance to the near plane
+ */
+void OcclusionBuffer::clear(const Mat4_t &m_view_proj, const float znear)
+{
+    std::fill(this->depths.begin(), this->depths.end(), std::numeric_limits<float>::max());
+    this->m_view_proj = m_view_proj;
+    this->znear = znear;
+}
+
+/**
+ * @brief Rasterizes the silhouette of a solid box, at the depth of its furthest corner.
+ * Since every point of the box lies in front of its furthest corner, this never hides more than the box itself
+ * would, while only taking a single span per row. Boxes which cross the near plane are skipped, since they can't
+ * be projected without clipping.
+ * @since 16-10-2026
+ * @param[in] box_min The lowest corner of the box. Every block within the box must be opaque
+ * @param[in] box_max The highest corner of the box
+ */
+void OcclusionBuffer::add_occluder(const Vec3_t box_min, const Vec3_t box_max)
+{
+    auto corners = std::array<Vec3_t, 8>{};
+    if (!project_box(box_min, box_max, corners))
+    {
+        return;
+    }
+
+    float depth = corners[0].z;
+    for (const auto &corner : corners)
+    {
+        depth = std::max(depth, corner.z);
+    }
+
+    // Convex hull of the corners (monotone chain), counter-clockwise
+    std::sort(corners.begin(), corners.end(), [](const Vec3_t &lhs, const Vec3_t &rhs)
+    {
+        return (lhs.x < rhs.x) || (lhs.x == rhs.x && lhs.y < rhs.y);
+    });
+
+    const auto cross = [](const Vec3_t &o, const Vec3_t &a, const Vec3_t &b)
+    {
+        return ((a.x - o.x) * (b.y - o.y)) - ((a.y - o.y) * (b.x - o.x));
+    };
+
+    auto hull = std::array<Vec3_t, 16>{};
+    size_t n = 0;
+    for (size_t i = 0; i < corners.size(); ++i)
+    {
+        while (n >= 2 && cross(hull[n - 2], hull[n - 1], corners[i]) <= 0.0f)
+        {
+            --n;
+        }
+        hull[n++] = corners[i];
+    }
+    for (size_t i = corners.size() - 1, lower = n + 1; i-- > 0;)
+    {
+        while (n >= lower && cross(hull[n - 2], hull[n - 1], corners[i]) <= 0.0f)
+        {
+            --n;
+        }
+        hull[n++] = corners[i];
+    }
+
+    // The first corner closes the hull
+    rasterize_polygon(hull.data(), n - 1, depth);
+}
+
+/**
+ * @brief Checks whether any part of a box may be in front of the occluders rasterized so far.
+ * @since 16-10-2026
+ * @param[in] box_min The lowest corner of the box
+ * @param[in] box_max The highest corner of the box
+ * @returns True if the box may be visible, or false if occluders hide all of it
+ */
+bool OcclusionBuffer::is_box_visible(const Vec3_t box_min, const Vec3_t box_max) const
+{
+    auto corners = std::array<Vec3_t, 8>{};
+    if (!project_box(box_min, box_max, corners))
+    {
+        return true;
+    }
+
+    float x_min = corners[0].x;
+    float x_max = corners[0].x;
+    float y_min = corners[0].y;
+    float y_max = corners[0].y;
+    float depth = corners[0].z;
+    for (const auto &corner : corners)
+    {
+        x_min = std::min(x_min, corner.x);
+        x_max = std::max(x_max, corner.x);
+        y_min = std::min(y_min, corner.y);
+        y_max = std::max(y_max, corner.y);
+        depth = std::min(depth, corner.z);
+    }
+
+    // Widen the rectangle by a pixel, since occluders only cover the pixels whose centers they contain
+    const int x0 = std::max((int)std::floor(x_min) - 1, 0);
+    const int x1 = std::min((int)std::floor(x_max) + 1, (int)this->width - 1);
+    const int y0 = std::max((int)std::floor(y_min) - 1, 0);
+    const int y1 = std::min((int)std::floor(y_max) + 1, (int)this->height - 1);
+
+    for (int y = y0; y <= y1; ++y)
+    {
+        const float *row = this->depths.data() + (y * this->width);
+        for (int x = x0; x <= x1; ++x)
+        {
+            if (depth <= row[x])
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Projects the corners of a box into the buffer's pixel coordinates.
+ * @since 16-10-2026
+ * @param[in] box_min The lowest corner of the box
+ * @param[in] box_max The highest corner of the box
+ * @param[out] corners The corners as (x, y, NDC depth), indexed by their bits (see OcclusionBuffer::add_occluder())
+ * @returns False if any corner lies in front of the near plane, otherwise returns true
+ */
+bool OcclusionBuffer::project_box(const Vec3_t box_min, const Vec3_t box_max, std::array<Vec3_t, 8> &corners) const
+{
+    for (size_t i = 0; i < corners.size(); ++i)
+    {
+        const Vec4_t corner = { .v = {
+            (i & 1) ? box_max.x : box_min.x,
+            (i & 2) ? box_max.y : box_min.y,
+            (i & 4) ? box_max.z : box_min.z,
+            1.0f
+        }};
+
+        const Vec4_t clip = qm_m4_v4_mul(this->m_view_proj, corner);
+        if (clip.w < this->znear)
+        {
+            return false;
+        }
+
+        corners[i].x = ((clip.x / clip.w) * 0.5f + 0.5f) * this->width;
+        corners[i].y = ((clip.y / clip.w) * 0.5f + 0.5f) * this->height;
+        corners[i].z = clip.z / clip.w;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Rasterizes a convex polygon at a constant depth, keeping the nearest depth of each pixel whose center it
+ * covers. Each edge bounds the pixels of a row from one side, so every row is narrowed down to a single span,
+ * which then takes one sweep that the compiler vectorizes.
+ * @since 16-10-2026
+ * @param[in] points The polygon's vertices in counter-clockwise order, as (x, y, unused)
+ * @param[in] count The amount of vertices
+ * @param[in] depth The NDC depth to rasterize at
+ */
+void OcclusionBuffer::rasterize_polygon(const Vec3_t *points, const size_t count, const float depth)
+{
+    if (count < 3)
+    {
+        return;
+    }
+
+    float y_min = points[0].y;
+    float y_max = points[0].y;
+    for (size_t i = 1; i < count; ++i)
+    {
+        y_min = std::min(y_min, points[i].y);
+        y_max = std::max(y_max, points[i].y);
+    }
+
+    const int row_min = std::max((int)std::ceil(y_min - 0.5f), 0);
+    const int row_max = std::min((int)std::floor(y_max - 0.5f), (int)this->height - 1);
+    if (row_min > row_max)
+    {
+        return;
+    }
+
+    // Where each edge crosses the first row, and how far the crossing moves from one row to the next.
+    // Edges going down bound the pixels of a row from the left, and edges going up from the right
+    auto left = std::array<float, 8>{};
+    auto left_step = std::array<float, 8>{};
+    auto right = std::array<float, 8>{};
+    auto right_step = std::array<float, 8>{};
+    size_t n_left = 0;
+    size_t n_right = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Vec3_t &from = points[i];
+        const Vec3_t &to = points[(i + 1) % count];
+        if (from.y == to.y)
+        {
+            continue;
+        }
+
+        const float step = (to.x - from.x) / (to.y - from.y);
+        const float crossing = from.x + (((row_min + 0.5f) - from.y) * step) - 0.5f;
+        if (from.y > to.y)
+        {
+            left[n_left] = crossing;
+            left_step[n_left++] = step;
+        }
+        else
+        {
+            right[n_right] = crossing;
+            right_step[n_right++] = step;
+        }
+    }
+
+    for (int y = row_min; y <= row_max; ++y)
+    {
+        const float dy = (float)(y - row_min);
+        float span_min = 0.0f;
+        float span_max = (float)(this->width - 1);
+        for (size_t k = 0; k < n_left; ++k)
+        {
+            span_min = std::max(span_min, left[k] + (dy * left_step[k]));
+        }
+        for (size_t k = 0; k < n_right; ++k)
+        {
+            span_max = std::min(span_max, right[k] + (dy * right_step[k]));
+        }
+        if (span_min > span_max)
+        {
+            continue;
+        }
+
+        // Both ends are non-negative, so truncation rounds them down
+        const int i_min = (int)span_min + ((float)(int)span_min < span_min);
+        const int i_max = (int)span_max;
+
+        float *row = this->depths.data() + (y * this->width);
+        for (int i = i_min; i <= i_max; ++i)
+        {
+            row[i] = std::min(row[i], depth);
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * @file pending_writes.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief Collects the blocks of structures (e.g. trees) which spill over into neighboring chunks.
+ * Writes are kept per target chunk and applied whenever that chunk is generated, so a structure never
+ * forces its neighbors to be generated early. Overlapping writes are merged by precedence rather than
+ * by arrival order, which makes the resulting terrain independent of the order chunks are generated in.
+ */
+
+#include "pending_writes.hpp"
+
+/**
+ * @brief Ranks a block type for the purpose of merging overlapping structures.
+ * Structures may only grow into air, and trunks win over leaves, whereas terrain is never replaced.
+ * @since 16-10-2026
+ * @param[in] type The block type
+ * @returns The precedence of __type__, where higher values win
+ */
+uint8_t PendingWrites::get_precedence(const BlockType type)
+{
+    switch (type)
+    {
+        case BlockType::AIR:
+            return 0;
+        case BlockType::LEAVES:
+            return 1;
+        case BlockType::WOOD:
+            return 2;
+        default:
+            return 3;
+    }
+}
+
+/**
+ * @brief Checks whether a structure block of type __type__ should replace a block of type __existing__.
+ * Since this is a strict ordering, applying the same writes in any order gives the same result.
+ * @since 16-10-2026
+ * @param[in] type The type of the block being placed
+ * @param[in] existing The type of the block currently occupying the cell
+ * @returns True if __type__ should replace __existing__, otherwise returns false
+ */
+bool PendingWrites::takes_precedence(const BlockType type, const BlockType existing)
+{
+    return get_precedence(type) > get_precedence(existing);
+}
+
+/**
+ * @brief Records __deferred__ so that it is applied to its chunk once generated.
+ * If the cell already holds a pending write, the one with the highest precedence is kept.
+ * @since 16-10-2026
+ * @param[in] deferred The block to record. Its location must lie within its chunk
+ */
+void PendingWrites::add(const DeferredBlock &deferred)
+{
+    const auto index = (uint16_t)(
+        (((deferred.block_location.z * KC::CHUNK_SIZE) + deferred.block_location.y) * KC::CHUNK_SIZE)
+        + deferred.block_location.x
+    );
+
+    std::lock_guard<std::mutex> lock(this->writes_mutex);
+    auto &cells = this->writes[ChunkMapKey(deferred.chunk_location)];
+    auto [needle, is_inserted] = cells.try_emplace(index, deferred.type);
+    if (!is_inserted && takes_precedence(deferred.type, needle->second))
+    {
+        needle->second = deferred.type;
+    }
+}
+
+/**
+ * @brief Retrieves every write that has been recorded for the chunk at __chunk_location__.
+ * Writes are retained, so that they are reapplied should the chunk be unloaded and generated again.
+ * Safe to call from multiple threads.
+ * @since 16-10-2026
+ * @param[in] chunk_location The location of the chunk
+ * @returns The blocks to be placed within the chunk
+ */
+std::vector<DeferredBlock> PendingWrites::get(const Vec3_t chunk_location) const
+{
+    auto deferred_list = std::vector<DeferredBlock>{};
+
+    std::lock_guard<std::mutex> lock(this->writes_mutex);
+    auto needle = this->writes.find(ChunkMapKey(chunk_location));
+    if (needle == this->writes.end())
+    {
+        return deferred_list;
+    }
+
+    deferred_list.reserve(needle->second.size());
+    for (const auto &[index, type] : needle->second)
+    {
+        const Vec3_t block_location = { .v = {
+            (float)(index % KC::CHUNK_SIZE),
+            (float)((index / KC::CHUNK_SIZE) % KC::CHUNK_SIZE),
+            (float)(index / (KC::CHUNK_SIZE * KC::CHUNK_SIZE))
+        }};
+        deferred_list.push_back(DeferredBlock(chunk_location, block_location, type));
+    }
+
+    return deferred_list;
+}
+
+/**
+ * @brief Evicts the writes of every chunk whose column lies at least __radius__ chunks from __center__.
+ * Structures are planted again if their own chunk is regenerated, so nothing is lost.
+ * @since 16-10-2026
+ * @param[in] center The column at the center of the loaded area
+ * @param[in] radius The distance (in chunks) beyond which writes are evicted
+ */
+void PendingWrites::evict_outside(const ChunkColumn center, const int radius)
+{
+    std::lock_guard<std::mutex> lock(this->writes_mutex);
+    std::erase_if(this->writes, [&](const auto &kv_pair)
+    {
+        const int dx = kv_pair.first.x - center.x;
+        const int dy = kv_pair.first.y - center.y;
+        return ((dx * dx) + (dy * dy)) >= (radius * radius);
+    });
+}
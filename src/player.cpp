@@ -3,7 +3,8 @@
 Player::Player() :
     v_vel{},
     v_jump{},
-    curr_move_mode(MovementMode::WALKING)
+    curr_move_mode(MovementMode::WALKING),
+    held_block(BlockType::STONE)
 {}
 
 Player &Player::get_instance()
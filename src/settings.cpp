@@ -76,6 +76,9 @@ void Settings::render_imgui_frame(KCWindow &win, Camera &camera)
     ImGui::SliderFloat("Camera X Pos", &camera.v_eye.x, camera.v_eye.x - 1.0f, camera.v_eye.x + 1.0f);
     ImGui::SliderFloat("Camera Y Pos", &camera.v_eye.y, camera.v_eye.y - 1.0f, camera.v_eye.y + 1.0f);
     ImGui::SliderFloat("Camera Z Pos", &camera.v_eye.z, camera.v_eye.z - 1.0f, camera.v_eye.z + 1.0f);
+    ImGui::Checkbox("Greedy Meshing", &greedy_meshing);
+    ImGui::Checkbox("Cave Culling", &cave_culling);
+    ImGui::Checkbox("Occlusion Culling", &occlusion_culling);
     ImGui::Checkbox("Game Running", &is_running);
     ImGui::End();
 
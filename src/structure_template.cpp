@@ -0,0 +1,328 @@
+/**
+ * @file structure_template.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief A box of blocks (e.g. a tree) which can be stamped into the world, loaded from res/structures.
+ * Templates are stored as a grid of palette indices. When stamped, the box is clipped against each chunk
+ * it overlaps, so every affected chunk is written in a single pass over its part of the box, without
+ * resolving the chunk of each block individually.
+ */
+
+#include "structure_template.hpp"
+
+/**
+ * @brief Default constructor for StructureTemplate. The template is empty.
+ * @since 16-10-2026
+ */
+StructureTemplate::StructureTemplate() :
+    size({ 0, 0, 0 }),
+    anchor({ 0, 0, 0 }),
+    palette({ BlockType::AIR })
+{}
+
+/**
+ * @brief Loads a template from the file located at __path__.
+ * Lines beginning with '#' are comments. The file consists of the following directives:
+ *   size <x> <y> <z>       Dimensions of the box
+ *   anchor <x> <y> <z>     Cell of the box which sits on the block that the structure is placed at
+ *   palette <char> <type>  Maps a character to a block type, e.g. "palette W WOOD"
+ *   layer                  Followed by __y__ rows of __x__ characters, from bottom to top
+ * There must be exactly __z__ layers. The character '.' leaves the existing block untouched. Structures
+ * only ever add blocks to the world (see PendingWrites::takes_precedence()), so a character mapped to AIR
+ * leaves the existing block untouched as well. If the file is malformed, the template is empty.
+ * @since 16-10-2026
+ * @param[in] path Path to the template file
+ */
+StructureTemplate::StructureTemplate(const std::filesystem::path path) :
+    StructureTemplate()
+{
+    auto ifs = std::ifstream(path);
+    if (!ifs.is_open())
+    {
+        std::cerr << "Failed to open structure template " << path << std::endl;
+        return;
+    }
+
+    std::map<char, uint8_t> symbols = { { '.', 0 } };
+    std::string line;
+    int z = -1;
+    int y = 0;
+
+    auto fail = [&](const std::string &reason)
+    {
+        std::cerr << "Malformed structure template " << path << ": " << reason << std::endl;
+        *this = StructureTemplate();
+    };
+
+    while (std::getline(ifs, line))
+    {
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        auto iss = std::istringstream(line);
+        std::string directive;
+        iss >> directive;
+
+        if (directive == "size")
+        {
+            iss >> this->size[0] >> this->size[1] >> this->size[2];
+            if (iss.fail() || this->size[0] <= 0 || this->size[1] <= 0 || this->size[2] <= 0)
+            {
+                fail("invalid size");
+                return;
+            }
+            this->cells.assign(this->size[0] * this->size[1] * this->size[2], 0);
+        }
+        else if (directive == "anchor")
+        {
+            iss >> this->anchor[0] >> this->anchor[1] >> this->anchor[2];
+            if (iss.fail())
+            {
+                fail("invalid anchor");
+                return;
+            }
+        }
+        else if (directive == "palette")
+        {
+            char symbol;
+            std::string name;
+            iss >> symbol >> name;
+
+            const auto type = parse_block_type(name);
+            if (iss.fail() || !type.has_value() || symbols.contains(symbol))
+            {
+                fail("invalid palette entry \"" + line + "\"");
+                return;
+            }
+            if (*type == BlockType::AIR)
+            {
+                symbols[symbol] = 0;
+                continue;
+            }
+            symbols[symbol] = (uint8_t)this->palette.size();
+            this->palette.push_back(*type);
+        }
+        else if (directive == "layer")
+        {
+            if (z >= 0 && y < this->size[1])
+            {
+                fail(
+                    "layer " + std::to_string(z) + " has " + std::to_string(y) +
+                    " rows, expected " + std::to_string(this->size[1])
+                );
+                return;
+            }
+            if (this->cells.empty() || ++z >= this->size[2])
+            {
+                fail("unexpected layer");
+                return;
+            }
+            y = 0;
+        }
+        else
+        {
+            // A row of the current layer
+            if (z < 0 || y >= this->size[1] || (int)line.size() < this->size[0])
+            {
+                fail("unexpected row \"" + line + "\"");
+                return;
+            }
+
+            for (int x = 0; x < this->size[0]; ++x)
+            {
+                auto needle = symbols.find(line[x]);
+                if (needle == symbols.end())
+                {
+                    fail("unknown symbol '" + std::string(1, line[x]) + "'");
+                    return;
+                }
+                this->cells[(((z * this->size[1]) + y) * this->size[0]) + x] = needle->second;
+            }
+            ++y;
+        }
+    }
+
+    if (this->cells.empty())
+    {
+        fail("missing size");
+    }
+    else if (z + 1 < this->size[2])
+    {
+        fail("found " + std::to_string(z + 1) + " layers, expected " + std::to_string(this->size[2]));
+    }
+    else if (y < this->size[1])
+    {
+        fail(
+            "layer " + std::to_string(z) + " has " + std::to_string(y) +
+            " rows, expected " + std::to_string(this->size[1])
+        );
+    }
+}
+
+/**
+ * @brief Checks whether the template places any blocks.
+ * @since 16-10-2026
+ * @returns True if the template is empty, otherwise returns false
+ */
+bool StructureTemplate::is_empty() const
+{
+    return this->cells.empty();
+}
+
+/**
+ * @brief Splits the blocks of the structure placed at __root_location__ between the chunks that it overlaps.
+ * The template's box is clipped against each of these chunks, and the cells within each clipped box are
+ * emitted relative to their own chunk.
+ * @since 16-10-2026
+ * @param[in] chunk_location The location of the chunk that the structure is placed in
+ * @param[in] root_location The location relative to __chunk_location__ that the anchor sits on
+ * @param[out] edits Appended with the blocks which lie within the chunk at __chunk_location__
+ * @param[out] deferred_list Appended with the blocks which lie within other chunks
+ */
+void StructureTemplate::stamp(
+    const Vec3_t chunk_location,
+    const Vec3_t root_location,
+    std::vector<BlockEdit> &edits,
+    std::vector<DeferredBlock> &deferred_list
+) const
+{
+    constexpr int N = KC::CHUNK_SIZE;
+
+    if (is_empty())
+    {
+        return;
+    }
+
+    // The template's box, relative to the chunk, and the range of chunks that it overlaps
+    int box_min[3];
+    int box_max[3];
+    int chunk_min[3];
+    int chunk_max[3];
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        box_min[axis] = (int)root_location.v[axis] - this->anchor[axis];
+        box_max[axis] = box_min[axis] + this->size[axis] - 1;
+        chunk_min[axis] = (int)std::floor((float)box_min[axis] / N);
+        chunk_max[axis] = (int)std::floor((float)box_max[axis] / N);
+    }
+
+    for (int cz = chunk_min[2]; cz <= chunk_max[2]; ++cz)
+    {
+        for (int cy = chunk_min[1]; cy <= chunk_max[1]; ++cy)
+        {
+            for (int cx = chunk_min[0]; cx <= chunk_max[0]; ++cx)
+            {
+                const int origin[3] = { cx * N, cy * N, cz * N };
+                const bool is_home = (cx == 0 && cy == 0 && cz == 0);
+                const Vec3_t target_location = { .v = {
+                    chunk_location.x + cx,
+                    chunk_location.y + cy,
+                    chunk_location.z + cz
+                }};
+
+                int lo[3];
+                int hi[3];
+                for (size_t axis = 0; axis < 3; ++axis)
+                {
+                    lo[axis] = std::max(box_min[axis], origin[axis]);
+                    hi[axis] = std::min(box_max[axis], origin[axis] + N - 1);
+                }
+
+                for (int z = lo[2]; z <= hi[2]; ++z)
+                {
+                    for (int y = lo[1]; y <= hi[1]; ++y)
+                    {
+                        const size_t row = (((z - box_min[2]) * this->size[1]) + (y - box_min[1])) * this->size[0];
+                        for (int x = lo[0]; x <= hi[0]; ++x)
+                        {
+                            const uint8_t symbol = this->cells[row + (x - box_min[0])];
+                            if (symbol == 0)
+                            {
+                                continue;
+                            }
+
+                            const Vec3_t block_location = { .v = {
+                                (float)(x - origin[0]),
+                                (float)(y - origin[1]),
+                                (float)(z - origin[2])
+                            }};
+
+                            if (is_home)
+                            {
+                                edits.push_back(BlockEdit{ .block_location = block_location, .type = this->palette[symbol] });
+                            }
+                            else
+                            {
+                                deferred_list.push_back(DeferredBlock(target_location, block_location, this->palette[symbol]));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Loads every template (*.kcs) within __directory__.
+ * @since 16-10-2026
+ * @param[in] directory The directory containing the templates
+ * @returns The templates that were loaded successfully, keyed by their file name (without its extension)
+ */
+std::map<std::string, StructureTemplate> StructureTemplate::load_all(const std::filesystem::path directory)
+{
+    auto structures = std::map<std::string, StructureTemplate>{};
+
+    std::error_code error;
+    for (const auto &entry : std::filesystem::directory_iterator(directory, error))
+    {
+        if (entry.path().extension() != ".kcs")
+        {
+            continue;
+        }
+
+        auto structure = StructureTemplate(entry.path());
+        if (!structure.is_empty())
+        {
+            structures.emplace(entry.path().stem().string(), std::move(structure));
+        }
+    }
+
+    if (error)
+    {
+        std::cerr << "Failed to load structure templates from " << directory << ": " << error.message() << std::endl;
+    }
+
+    return structures;
+}
+
+/**
+ * @brief Converts the name of a block type (e.g. "WOOD") into its BlockType.
+ * @since 16-10-2026
+ * @param[in] name The name of the block type
+ * @returns The block type, or std::nullopt if __name__ is unknown
+ */
+std::optional<BlockType> StructureTemplate::parse_block_type(const std::string &name)
+{
+    static const std::map<std::string, BlockType> block_types = {
+        { "AIR",    BlockType::AIR },
+        { "DIRT",   BlockType::DIRT },
+        { "GRASS",  BlockType::GRASS },
+        { "WOOD",   BlockType::WOOD },
+        { "LEAVES", BlockType::LEAVES },
+        { "STONE",  BlockType::STONE },
+        { "SAND",   BlockType::SAND },
+        { "WATER",  BlockType::WATER }
+    };
+
+    auto needle = block_types.find(name);
+    if (needle == block_types.end())
+    {
+        return std::nullopt;
+    }
+
+    return needle->second;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file thread_pool.cpp
+ * @author Neil Kingdom
+ * @since 16-10-2026
+ * @version 1.0
+ * @brief A fixed-size pool of worker threads which execute tasks in the order that they were submitted.
+ */
+
+#include "thread_pool.hpp"
+
+/**
+ * @brief Parameterized constructor for ThreadPool class.
+ * @since 16-10-2026
+ * @param[in] n_workers The amount of worker threads to spawn (minimum one)
+ */
+ThreadPool::ThreadPool(const unsigned n_workers) :
+    is_stopping(false)
+{
+    for (unsigned i = 0; i < std::max(n_workers, 1U); ++i)
+    {
+        this->workers.emplace_back(&ThreadPool::worker_loop, this);
+    }
+}
+
+/**
+ * @brief Default destructor for ThreadPool class. Stops the pool if it is still running, see ThreadPool::stop().
+ * @since 16-10-2026
+ */
+ThreadPool::~ThreadPool()
+{
+    stop();
+}
+
+/**
+ * @brief Queues __task__ to be executed by the next available worker.
+ * @since 16-10-2026
+ * @param[in] task The task to be executed
+ */
+void ThreadPool::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->tasks_mutex);
+        if (this->is_stopping)
+        {
+            return;
+        }
+        this->tasks.push(std::move(task));
+    }
+    this->tasks_cv.notify_one();
+}
+
+/**
+ * @brief Stops the pool. Tasks which have not yet been started are discarded, and running tasks are waited
+ * upon. Tasks submitted afterwards are never executed. Calling this more than once has no further effect.
+ * @since 16-10-2026
+ */
+void ThreadPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->tasks_mutex);
+        this->is_stopping = true;
+        this->tasks = {};
+    }
+    this->tasks_cv.notify_all();
+
+    for (auto &worker : this->workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+/**
+ * @brief Retrieves the amount of worker threads in the pool.
+ * @since 16-10-2026
+ * @returns The amount of worker threads
+ */
+size_t ThreadPool::size() const
+{
+    return this->workers.size();
+}
+
+/**
+ * @brief Main loop of each worker thread. Executes tasks until the pool is stopped.
+ * @since 16-10-2026
+ */
+void ThreadPool::worker_loop()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(this->tasks_mutex);
+            this->tasks_cv.wait(lock, [this]()
+            {
+                return this->is_stopping || !this->tasks.empty();
+            });
+
+            if (this->is_stopping)
+            {
+                return;
+            }
+
+            task = std::move(this->tasks.front());
+            this->tasks.pop();
+        }
+
+        task();
+    }
+}